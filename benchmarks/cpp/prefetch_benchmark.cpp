@@ -0,0 +1,121 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares iterating a large vector of tables, reading a scalar and a string
+// of each, with a plain loop and with flatbuffers::Prefetched() at several
+// distances. The tables are created in a random order, so consecutive
+// elements are far apart in the buffer, as in buffers built from a hash map.
+// This is done for a buffer in memory, and for one built into and read from
+// a memory-mapped file.
+//
+// Usage: flatbenchmark [count of tables] [path of the file to map]
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/mmap_builder.h"
+#include "monster_generated.h"
+
+using namespace MyGame::Sample;
+
+static void BuildWeapons(flatbuffers::FlatBufferBuilder &fbb, size_t count) {
+  std::vector<size_t> order(count);
+  for (size_t i = 0; i < count; i++) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937(42));
+  std::vector<flatbuffers::Offset<Weapon>> weapons(count);
+  for (auto it = order.begin(); it != order.end(); ++it) {
+    auto name = fbb.CreateString("weapon" + std::to_string(*it));
+    // Some without damage, so there are two vtables.
+    weapons[*it] = CreateWeapon(fbb, name, static_cast<int16_t>(*it % 7));
+  }
+  auto vec = fbb.CreateVector(weapons);
+  fbb.Finish(CreateMonster(fbb, nullptr, 150, 100, 0, 0, Color_Red, vec));
+}
+
+template<typename Range> static int64_t Sum(const Range &weapons) {
+  int64_t sum = 0;
+  for (auto it = weapons.begin(); it != weapons.end(); ++it) {
+    sum += (*it)->damage() + static_cast<int64_t>((*it)->name()->size());
+  }
+  return sum;
+}
+
+template<typename Range>
+static void Time(const char *name, const Range &weapons) {
+  int64_t sum = 0;
+  double best = 0;
+  for (int run = 0; run < 5; run++) {
+    auto start = std::chrono::steady_clock::now();
+    sum = Sum(weapons);
+    std::chrono::duration<double, std::milli> ms =
+        std::chrono::steady_clock::now() - start;
+    if (!run || ms.count() < best) best = ms.count();
+  }
+  printf("  %-16s %9.2f ms  (sum %lld)\n", name, best,
+         static_cast<long long>(sum));
+}
+
+static void Run(const char *what, const uint8_t *buf) {
+  auto weapons = GetMonster(buf)->weapons();
+  printf("%s, %u tables:\n", what, weapons->size());
+  Time("plain", *weapons);
+  Time("prefetched(4)", flatbuffers::Prefetched(weapons, 4));
+  Time("prefetched(16)", flatbuffers::Prefetched(weapons, 16));
+  Time("prefetched(64)", flatbuffers::Prefetched(weapons, 64));
+}
+
+int main(int argc, const char *argv[]) {
+  size_t count = argc > 1 ? static_cast<size_t>(atol(argv[1])) : 1 << 22;
+  const char *path = argc > 2 ? argv[2] : "flatbenchmark.bin";
+
+  flatbuffers::FlatBufferBuilder fbb;
+  BuildWeapons(fbb, count);
+  Run("In memory", fbb.GetBufferPointer());
+
+  size_t size = 0;
+  {
+    flatbuffers::MmapFileBuilder mfbb(path);
+    if (!mfbb.ok()) {
+      printf("Can't map %s\n", path);
+      return 1;
+    }
+    BuildWeapons(mfbb, count);
+    size = mfbb.GetSize();
+    if (!mfbb.Commit()) {
+      printf("Can't write %s\n", path);
+      return 1;
+    }
+  }
+  auto fd = open(path, O_RDONLY);
+  auto map = fd < 0 ? MAP_FAILED : mmap(nullptr, size, PROT_READ, MAP_SHARED,
+                                        fd, 0);
+  if (map == MAP_FAILED) {
+    printf("Can't map %s\n", path);
+    return 1;
+  }
+  Run("Memory-mapped file", static_cast<const uint8_t *>(map));
+  munmap(map, size);
+  close(fd);
+  unlink(path);
+  return 0;
+}
@@ -304,6 +304,13 @@ template<typename T> FLATBUFFERS_CONSTEXPR inline bool IsConstTrue(T t) {
   #endif
 #endif
 
+// Hints that memory at the given address will be read soon.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+  #define FLATBUFFERS_PREFETCH(addr) ((void)(addr))
+#endif
+
 /// @endcond
 
 /// @file
@@ -315,6 +322,10 @@ namespace flatbuffers {
 // offset values between 32bit and 64bit systems.
 typedef uint32_t uoffset_t;
 
+// Offset used by fields with the `offset64` attribute, to refer to data at
+// the end of buffers larger than 32-bit offsets can span.
+typedef uint64_t uoffset64_t;
+
 // Signed offsets for references that can go in both directions.
 typedef int32_t soffset_t;
 
@@ -327,6 +338,9 @@ typedef uintmax_t largest_scalar_t;
 // In 32bits, this evaluates to 2GB - 1
 #define FLATBUFFERS_MAX_BUFFER_SIZE ((1ULL << (sizeof(::flatbuffers::soffset_t) * 8 - 1)) - 1)
 
+// The size of buffers that use 64-bit offsets is only limited by size_t.
+#define FLATBUFFERS_MAX_64_BUFFER_SIZE ((~static_cast<size_t>(0)) >> 1)
+
 // We support aligning the contents of buffers up to this size.
 #define FLATBUFFERS_MAX_ALIGNMENT 16
 
@@ -18,9 +18,11 @@
 #define FLATBUFFERS_H_
 
 #include "flatbuffers/base.h"
+#include "flatbuffers/key_sort.h"
 #include "flatbuffers/stl_emulation.h"
 
 #ifndef FLATBUFFERS_CPP98_STL
+#  include <chrono>
 #  include <functional>
 #endif
 
@@ -72,6 +74,16 @@ template<typename T> struct Offset {
   bool IsNull() const { return !o; }
 };
 
+// Like Offset, for data referred to by fields with the `offset64` attribute.
+// Unlike Offset, it counts from the end of the buffer including the 64-bit
+// region (see FlatBufferBuilder::CreateVector64()).
+template<typename T> struct Offset64 {
+  uoffset64_t o;
+  Offset64() : o(0) {}
+  Offset64(uoffset64_t _o) : o(_o) {}
+  bool IsNull() const { return !o; }
+};
+
 inline void EndianCheck() {
   int endiantest = 1;
   // If this fails, see FLATBUFFERS_LITTLEENDIAN above.
@@ -94,6 +106,108 @@ template<typename T> FLATBUFFERS_CONSTEXPR size_t AlignOf() {
   // clang-format on
 }
 
+// With FLATBUFFERS_CHECKED_ACCESS defined (consistently, for the whole
+// program), the accessors of Table, and of vectors of offsets, check the data
+// they read lies within the buffer of the innermost CheckedAccess scope on
+// the current thread, and is aligned. This makes reading a buffer that was
+// not verified memory safe, at the cost of a check per access (see
+// CheckedAccess below).
+/// @cond FLATBUFFERS_INTERNAL
+struct CheckedAccessState {
+  const uint8_t *begin;
+  size_t size;
+  bool failed;
+};
+
+// clang-format off
+#ifdef FLATBUFFERS_CHECKED_ACCESS
+  inline CheckedAccessState &CurrentCheckedAccess() {
+    static thread_local CheckedAccessState state = { nullptr, 0, false };
+    return state;
+  }
+#endif  // FLATBUFFERS_CHECKED_ACCESS
+// clang-format on
+
+// Whether accesses are being checked, i.e. this is inside a CheckedAccess
+// scope.
+inline bool CheckingAccess() {
+  // clang-format off
+  #ifdef FLATBUFFERS_CHECKED_ACCESS
+    return CurrentCheckedAccess().begin != nullptr;
+  #else
+    return false;
+  #endif
+  // clang-format on
+}
+
+// Records a failed check, and returns false.
+inline bool AccessFailed() {
+  // clang-format off
+  #ifdef FLATBUFFERS_CHECKED_ACCESS
+    CurrentCheckedAccess().failed = true;
+  #endif
+  // clang-format on
+  return false;
+}
+
+// Whether `count` elements of `elem_size` bytes at `p`, aligned to `align`
+// from the start of the buffer, may be read. Always true outside of a
+// CheckedAccess scope.
+inline bool AccessOk(const void *p, size_t elem_size, size_t align,
+                     size_t count = 1) {
+  // clang-format off
+  #ifdef FLATBUFFERS_CHECKED_ACCESS
+    auto &state = CurrentCheckedAccess();
+    if (!state.begin) return true;
+    // Pointers before the buffer wrap around to large offsets.
+    auto o = static_cast<size_t>(reinterpret_cast<const uint8_t *>(p) -
+                                 state.begin);
+    if (o <= state.size && (o & (align - 1)) == 0 &&
+        count <= (state.size - o) / elem_size)
+      return true;
+    return AccessFailed();
+  #else
+    (void)p;
+    (void)elem_size;
+    (void)align;
+    (void)count;
+    return true;
+  #endif
+  // clang-format on
+}
+
+// Checks the object an offset points to may be read. Tables, and union
+// values, need just their vtable offset here, as their fields are checked
+// as they are read. Specialized for strings and vectors below.
+template<typename T> struct AccessCheck {
+  static bool Ok(const uint8_t *p) {
+    return AccessOk(p, sizeof(soffset_t), sizeof(soffset_t));
+  }
+};
+
+// The AccessCheck for the pointer type P returned by an accessor.
+template<typename P> struct PointeeAccessCheck {
+  typedef AccessCheck<typename std::remove_cv<
+      typename std::remove_pointer<P>::type>::type>
+      type;
+};
+
+// Checks a struct the pointer type P points to may be read. Structs of
+// unknown type need just a byte.
+template<typename P> struct StructAccessCheck {
+  typedef typename std::remove_pointer<P>::type S;
+  static bool Ok(const uint8_t *p) {
+    return AccessOk(p, sizeof(S), AlignOf<S>());
+  }
+};
+template<> struct StructAccessCheck<const void *> {
+  static bool Ok(const uint8_t *p) { return AccessOk(p, 1, 1); }
+};
+template<> struct StructAccessCheck<void *> {
+  static bool Ok(const uint8_t *p) { return AccessOk(p, 1, 1); }
+};
+/// @endcond
+
 // When we read serialized data from memory, in the case of most scalars,
 // we want to just read T, but in the case of Offset, we want to actually
 // perform the indirection and return a pointer.
@@ -102,6 +216,9 @@ template<typename T> FLATBUFFERS_CONSTEXPR size_t AlignOf() {
 // return type like this.
 // The typedef is for the convenience of callers of this function
 // (avoiding the need for a trailing return decltype)
+// Prefetch() hints that the data of element i will be read soon, and
+// PrefetchVTable() that its vtable will be, which reads the (hopefully
+// prefetched) table to find it.
 template<typename T> struct IndirectHelper {
   typedef T return_type;
   typedef T mutable_return_type;
@@ -109,6 +226,22 @@ template<typename T> struct IndirectHelper {
   static return_type Read(const uint8_t *p, uoffset_t i) {
     return EndianScalar((reinterpret_cast<const T *>(p))[i]);
   }
+  static void Prefetch(const uint8_t *p, uoffset_t i) {
+    FLATBUFFERS_PREFETCH(p + i * sizeof(T));
+  }
+  static void PrefetchVTable(const uint8_t *, uoffset_t) {}
+};
+struct String;
+
+// Objects referred to by offsets that start with the offset of a vtable.
+template<typename T> struct HasVTable {
+  static const bool value = true;
+};
+template<> struct HasVTable<String> {
+  static const bool value = false;
+};
+template<> struct HasVTable<void> {
+  static const bool value = false;  // Union values need not be tables.
 };
 template<typename T> struct IndirectHelper<Offset<T>> {
   typedef const T *return_type;
@@ -116,7 +249,19 @@ template<typename T> struct IndirectHelper<Offset<T>> {
   static const size_t element_stride = sizeof(uoffset_t);
   static return_type Read(const uint8_t *p, uoffset_t i) {
     p += i * sizeof(uoffset_t);
-    return reinterpret_cast<return_type>(p + ReadScalar<uoffset_t>(p));
+    p += ReadScalar<uoffset_t>(p);
+    return AccessCheck<T>::Ok(p) ? reinterpret_cast<return_type>(p) : nullptr;
+  }
+  static void Prefetch(const uint8_t *p, uoffset_t i) {
+    p += i * sizeof(uoffset_t);
+    FLATBUFFERS_PREFETCH(p + ReadScalar<uoffset_t>(p));
+  }
+  static void PrefetchVTable(const uint8_t *p, uoffset_t i) {
+    // The table may not be readable, see AccessOk().
+    if (!HasVTable<T>::value || CheckingAccess()) return;
+    p += i * sizeof(uoffset_t);
+    auto table = p + ReadScalar<uoffset_t>(p);
+    FLATBUFFERS_PREFETCH(table - ReadScalar<soffset_t>(table));
   }
 };
 template<typename T> struct IndirectHelper<const T *> {
@@ -126,6 +271,10 @@ template<typename T> struct IndirectHelper<const T *> {
   static return_type Read(const uint8_t *p, uoffset_t i) {
     return reinterpret_cast<const T *>(p + i * sizeof(T));
   }
+  static void Prefetch(const uint8_t *p, uoffset_t i) {
+    FLATBUFFERS_PREFETCH(p + i * sizeof(T));
+  }
+  static void PrefetchVTable(const uint8_t *, uoffset_t) {}
 };
 
 // An STL compatible iterator implementation for Vector below, effectively
@@ -236,7 +385,74 @@ struct VectorReverseIterator : public std::reverse_iterator<Iterator> {
   }
 };
 
-struct String;
+/// @cond FLATBUFFERS_INTERNAL
+// How Vector::LookupByKey() compares the keys of elements, as returned by
+// their GetKey(), with the key looked up: scalars are compared as the key
+// type of the elements, strings bytewise with their length.
+template<typename EK> struct KeyLookup {
+  typedef EK key_type;
+  template<typename K> static key_type Key(K key) {
+    return static_cast<key_type>(key);
+  }
+  static bool Less(EK a, EK b) { return a < b; }
+};
+
+template<> struct KeyLookup<const String *> {
+  typedef KeyString key_type;
+  static key_type Key(const char *key) { return KeyString(key, strlen(key)); }
+  static inline bool Less(const String *a, const KeyString &b);
+  static inline bool Less(const KeyString &a, const String *b);
+};
+
+// Under FLATBUFFERS_CHECKED_ACCESS, elements of vectors of tables, and their
+// string keys, read as nullptr when they fail the checks (see AccessOk()).
+// Lookups then don't find the key rather than dereference them.
+inline bool KeyReadable(const String *key) { return key != nullptr; }
+template<typename K> bool KeyReadable(K) { return true; }
+template<typename E> bool ElementKeyReadable(const E *elem) {
+  return !CheckingAccess() || (elem && KeyReadable(elem->GetKey()));
+}
+
+// Whether the tables or structs that P points to have a GetKey(), which code
+// generated by older versions of flatc lacks. Sorting and lookups then use
+// their KeyCompareLessThan() and KeyCompareWithValue() instead.
+template<typename P> class HasGetKey {
+  template<typename Q>
+  static char Test(decltype(std::declval<Q>()->GetKey()) *);
+  template<typename Q> static long Test(...);
+
+ public:
+  static const bool value = sizeof(Test<P>(nullptr)) == 1;
+};
+
+// How LookupByKey() compares the key of an element, pointed to by P, with
+// the key looked up.
+template<typename P, typename K, bool = HasGetKey<P>::value>
+class ElementKeyCompare {
+  typedef KeyLookup<decltype(std::declval<P>()->GetKey())> Lookup;
+
+ public:
+  explicit ElementKeyCompare(K key) : key_(Lookup::Key(key)) {}
+  bool Readable(P elem) const { return ElementKeyReadable(elem); }
+  bool Less(P elem) const { return Lookup::Less(elem->GetKey(), key_); }
+  bool Greater(P elem) const { return Lookup::Less(key_, elem->GetKey()); }
+
+ private:
+  const typename Lookup::key_type key_;
+};
+
+template<typename P, typename K> class ElementKeyCompare<P, K, false> {
+ public:
+  explicit ElementKeyCompare(K key) : key_(key) {}
+  // Only the element can be checked, as its key is read by the comparison.
+  bool Readable(P elem) const { return !CheckingAccess() || elem; }
+  bool Less(P elem) const { return elem->KeyCompareWithValue(key_) < 0; }
+  bool Greater(P elem) const { return elem->KeyCompareWithValue(key_) > 0; }
+
+ private:
+  const K key_;
+};
+/// @endcond
 
 // This is used as a helper type for accessing vectors.
 // Vector::data() assumes the vector elements start after the length field.
@@ -347,17 +563,39 @@ template<typename T> class Vector {
   const T *data() const { return reinterpret_cast<const T *>(Data()); }
   T *data() { return reinterpret_cast<T *>(Data()); }
 
-  template<typename K> return_type LookupByKey(K key) const {
-    void *search_result = std::bsearch(
-        &key, Data(), size(), IndirectHelper<T>::element_stride, KeyCompare<K>);
+  // Hints that elements [first, last) will be read soon. For vectors of
+  // tables or strings, that is the objects they refer to.
+  void prefetch_range(uoffset_t first, uoffset_t last) const {
+    FLATBUFFERS_ASSERT(first <= last && last <= size());
+    for (auto i = first; i < last; i++) IndirectHelper<T>::Prefetch(Data(), i);
+  }
 
-    if (!search_result) {
+  template<typename K> return_type LookupByKey(K key) const {
+    const ElementKeyCompare<return_type, K> cmp(key);
+    auto n = size();
+    if (!n) return nullptr;
+    // Binary search for the first element not less than the key, where each
+    // step selects the lower or upper half without a branch.
+    uoffset_t first = 0;
+    while (n > 1) {
+      auto half = n / 2;
+      // Either half may be searched next.
+      FLATBUFFERS_PREFETCH(Data() + (first + half / 2) *
+                                        IndirectHelper<T>::element_stride);
+      FLATBUFFERS_PREFETCH(Data() + (first + half + half / 2) *
+                                        IndirectHelper<T>::element_stride);
+      const auto elem = KeyAt(first + half);
+      if (!cmp.Readable(elem)) return nullptr;
+      first += cmp.Less(elem) ? half : 0;
+      n -= half;
+    }
+    if (!cmp.Readable(KeyAt(first))) return nullptr;
+    first += cmp.Less(KeyAt(first)) ? 1 : 0;
+    if (first == size() || !cmp.Readable(KeyAt(first)) ||
+        cmp.Greater(KeyAt(first))) {
       return nullptr;  // Key not found.
     }
-
-    const uint8_t *element = reinterpret_cast<const uint8_t *>(search_result);
-
-    return IndirectHelper<T>::Read(element, 0);
+    return Get(first);
   }
 
  protected:
@@ -373,17 +611,91 @@ template<typename T> class Vector {
   Vector(const Vector &);
   Vector &operator=(const Vector &);
 
-  template<typename K> static int KeyCompare(const void *ap, const void *bp) {
-    const K *key = reinterpret_cast<const K *>(ap);
-    const uint8_t *data = reinterpret_cast<const uint8_t *>(bp);
-    auto table = IndirectHelper<T>::Read(data, 0);
+  typename IndirectHelper<T>::return_type KeyAt(uoffset_t i) const {
+    return IndirectHelper<T>::Read(Data(), i);
+  }
+};
+
+// Iterates a vector like its const_iterator, while prefetching the elements
+// `distance` ahead, and for tables the vtables of those half as far ahead,
+// whose tables have been prefetched by then. This hides the chain of cache
+// misses (offset, table, vtable) of a loop over a large vector of tables or
+// strings that isn't in cache. Returned by Prefetched() below.
+template<typename T> class PrefetchedRange {
+ public:
+  typedef typename IndirectHelper<T>::return_type return_type;
+
+  class const_iterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef return_type value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const return_type *pointer;
+    typedef return_type reference;
+
+    const_iterator(const Vector<T> *vec, uoffset_t i, uoffset_t distance)
+        : vec_(vec), i_(i), distance_(distance) {}
+
+    bool operator==(const const_iterator &other) const {
+      return i_ == other.i_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return i_ != other.i_;
+    }
+
+    return_type operator*() const { return vec_->Get(i_); }
+    return_type operator->() const { return vec_->Get(i_); }
+
+    const_iterator &operator++() {
+      i_++;
+      const auto size = vec_->size();
+      if (i_ + distance_ < size) {
+        IndirectHelper<T>::Prefetch(vec_->Data(), i_ + distance_);
+      }
+      if (i_ + distance_ / 2 < size) {
+        IndirectHelper<T>::PrefetchVTable(vec_->Data(), i_ + distance_ / 2);
+      }
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator temp(*this);
+      ++*this;
+      return temp;
+    }
+
+   private:
+    const Vector<T> *vec_;
+    uoffset_t i_;
+    uoffset_t distance_;
+  };
 
-    // std::bsearch compares with the operands transposed, so we negate the
-    // result here.
-    return -table->KeyCompareWithValue(*key);
+  PrefetchedRange(const Vector<T> *vec, uoffset_t distance)
+      : vec_(vec), distance_(distance) {}
+
+  uoffset_t size() const { return vec_ ? vec_->size() : 0; }
+
+  const_iterator begin() const {
+    // Start fetching the first elements, their vtables follow once the
+    // iteration gets going.
+    if (size()) vec_->prefetch_range(0, (std::min)(distance_, size()));
+    return const_iterator(vec_, 0, distance_);
   }
+  const_iterator end() const { return const_iterator(vec_, size(), 0); }
+
+ private:
+  const Vector<T> *vec_;
+  uoffset_t distance_;
 };
 
+// Iterates `vec` (which may be null) with prefetching, as in
+// `for (auto monster : Prefetched(monsters)) ...`. A larger `distance` hides
+// more latency, but fetches more that may be evicted before it is used.
+template<typename T>
+PrefetchedRange<T> Prefetched(const Vector<T> *vec, uoffset_t distance = 16) {
+  return PrefetchedRange<T>(vec, distance);
+}
+
 // Represent a vector much like the template above, but in this case we
 // don't know what the element types are (used with reflection.h).
 class VectorOfAny {
@@ -630,6 +942,141 @@ struct String : public Vector<char> {
   }
 };
 
+/// @cond FLATBUFFERS_INTERNAL
+// Strings must fit in the buffer with their terminator.
+template<> struct AccessCheck<String> {
+  static bool Ok(const uint8_t *p) {
+    if (!CheckingAccess()) return true;
+    if (!AccessOk(p, sizeof(uoffset_t), sizeof(uoffset_t))) return false;
+    auto size = ReadScalar<uoffset_t>(p);
+    auto data = p + sizeof(uoffset_t);
+    return AccessOk(data, 1, 1, size) && AccessOk(data + size, 1, 1) &&
+           (data[size] == '\0' || AccessFailed());
+  }
+};
+
+// Vectors must fit in the buffer with all their elements.
+template<typename T> struct AccessCheck<Vector<T>> {
+  static bool Ok(const uint8_t *p) {
+    if (!CheckingAccess()) return true;
+    return AccessOk(p, sizeof(uoffset_t), sizeof(uoffset_t)) &&
+           AccessOk(p + sizeof(uoffset_t), IndirectHelper<T>::element_stride, 1,
+                    ReadScalar<uoffset_t>(p));
+  }
+};
+
+inline bool KeyLookup<const String *>::Less(const String *a,
+                                            const KeyString &b) {
+  return StringLessThan(a->data(), a->size(), b.str,
+                        static_cast<uoffset_t>(b.len));
+}
+
+inline bool KeyLookup<const String *>::Less(const KeyString &a,
+                                            const String *b) {
+  return StringLessThan(a.str, static_cast<uoffset_t>(a.len), b->data(),
+                        b->size());
+}
+/// @endcond
+
+// Access to a vector of tables or structs with a key that is stored in
+// Eytzinger order (the `eytzinger` attribute), as returned by the generated
+// `field_by_key()` accessors. Iterates in key order.
+template<typename T> class EytzingerVector {
+ public:
+  typedef typename IndirectHelper<T>::return_type return_type;
+
+  // Visits the elements in key order, which is not the order in memory.
+  class const_iterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef return_type value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const return_type *pointer;
+    typedef return_type reference;
+
+    const_iterator(const Vector<T> *vec, uoffset_t node)
+        : vec_(vec), node_(node) {}
+
+    bool operator==(const const_iterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return node_ != other.node_;
+    }
+
+    return_type operator*() const { return vec_->Get(node_ - 1); }
+    return_type operator->() const { return vec_->Get(node_ - 1); }
+
+    const_iterator &operator++() {
+      node_ = EytzingerNext(node_, vec_->size());
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator temp(*this);
+      ++*this;
+      return temp;
+    }
+
+   private:
+    const Vector<T> *vec_;
+    uoffset_t node_;  // Numbered from 1, 0 is the end.
+  };
+
+  explicit EytzingerVector(const Vector<T> *vec) : vec_(vec) {}
+
+  // The underlying vector, which may be null if the field is not set.
+  const Vector<T> *vector() const { return vec_; }
+  uoffset_t size() const { return vec_ ? vec_->size() : 0; }
+  bool empty() const { return size() == 0; }
+
+  const_iterator begin() const {
+    return const_iterator(vec_, EytzingerFirst(size()));
+  }
+  const_iterator end() const { return const_iterator(vec_, 0); }
+
+  template<typename K> return_type LookupByKey(K key) const {
+    const ElementKeyCompare<return_type, K> cmp(key);
+    const auto n = size();
+    // Descend the tree to a leaf, without branching on the comparisons. The
+    // bits of `node` below its leading one record the path taken.
+    uoffset_t node = 1;
+    while (node <= n) {
+      // The nodes 4 levels down are all in one or two cache lines.
+      const auto ahead = (std::min)(16 * static_cast<size_t>(node),
+                                    static_cast<size_t>(n));
+      FLATBUFFERS_PREFETCH(vec_->Data() +
+                           (ahead - 1) * IndirectHelper<T>::element_stride);
+      const auto elem = KeyAt(node);
+      if (!cmp.Readable(elem)) return nullptr;
+      node = 2 * node + (cmp.Less(elem) ? 1 : 0);
+    }
+    // The last node where the path went left is the first one not less than
+    // the key: drop the right turns after it, then the left turn itself.
+    while (node & 1) node >>= 1;
+    node >>= 1;
+    if (!node || !cmp.Readable(KeyAt(node)) || cmp.Greater(KeyAt(node))) {
+      return nullptr;  // Key not found.
+    }
+    return KeyAt(node);
+  }
+
+ private:
+  return_type KeyAt(uoffset_t node) const {
+    return IndirectHelper<T>::Read(vec_->Data(), node - 1);
+  }
+
+  const Vector<T> *vec_;
+};
+
+/// @cond FLATBUFFERS_INTERNAL
+// The key returned by a generated GetKey(), in the form SortByKey() expects.
+inline KeyString SortKeyOf(const String *key) {
+  return KeyString(key->c_str(), key->size());
+}
+template<typename T> T SortKeyOf(T key) { return key; }
+/// @endcond
+
 // Convenience function to get std::string from a String returning an empty
 // string on null pointer.
 static inline std::string GetString(const String *str) {
@@ -729,6 +1176,126 @@ inline uint8_t *ReallocateDownward(Allocator *allocator, uint8_t *old_p,
                          old_p, old_size, new_size, in_use_back, in_use_front);
 }
 
+// ArenaAllocator hands out memory from large blocks by bumping a pointer, and
+// frees all of it at once in Reset() or its destructor. It suits builders
+// (and the buffers they release) that live about as long as one request.
+// Blocks are filled from the top down, so the most recent allocation can grow
+// downwards in place, without copying the data at its back: exactly what
+// `vector_downward` needs. Anything allocated from an arena must not be used
+// after the arena is reset or destroyed. Not thread-safe.
+class ArenaAllocator : public Allocator {
+ public:
+  struct Stats {
+    size_t num_allocations;  // Calls to allocate().
+    size_t num_in_place_reallocations;  // Growths that needed no new memory.
+    size_t bytes_allocated;  // Total size of all allocations.
+    size_t num_blocks;       // Blocks currently held by the arena.
+    size_t bytes_reserved;   // Total size of those blocks.
+  };
+
+  // `block_size` is the size of each block obtained from `upstream` (or the
+  // DefaultAllocator if null). Larger allocations get a block of their own.
+  explicit ArenaAllocator(size_t block_size = 64 * 1024,
+                          Allocator *upstream = nullptr)
+      : block_size_(block_size),
+        upstream_(upstream),
+        block_(nullptr),
+        cur_(nullptr) {
+    memset(&stats_, 0, sizeof(stats_));
+  }
+
+  ~ArenaAllocator() { FreeBlocks(0); }
+
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    stats_.num_allocations++;
+    stats_.bytes_allocated += size;
+    // Round down from the top, so the end of each allocation is as aligned as
+    // its size allows.
+    if (!cur_ || size > static_cast<size_t>(cur_ - block_) ||
+        AlignDown(cur_ - size) < block_) {
+      AddBlock(size + FLATBUFFERS_MAX_ALIGNMENT);
+    }
+    cur_ = AlignDown(cur_ - size);
+    return cur_;
+  }
+
+  // Only the most recent allocation can be given back before Reset().
+  void deallocate(uint8_t *p, size_t size) FLATBUFFERS_OVERRIDE {
+    if (p == cur_) cur_ += size;
+  }
+
+  uint8_t *reallocate_downward(uint8_t *old_p, size_t old_size,
+                               size_t new_size, size_t in_use_back,
+                               size_t in_use_front) FLATBUFFERS_OVERRIDE {
+    FLATBUFFERS_ASSERT(new_size > old_size);  // vector_downward only grows
+    auto grow = new_size - old_size;
+    // If this is the most recent allocation and there is room below it, the
+    // region simply extends downwards: only the front needs to move.
+    if (old_p == cur_ && grow <= static_cast<size_t>(cur_ - block_)) {
+      stats_.num_in_place_reallocations++;
+      stats_.bytes_allocated += grow;
+      cur_ -= grow;
+      memmove(cur_, old_p, in_use_front);
+      return cur_;
+    }
+    return Allocator::reallocate_downward(old_p, old_size, new_size,
+                                          in_use_back, in_use_front);
+  }
+
+  // Frees all allocations at once. The current block is kept for reuse.
+  void Reset() {
+    FreeBlocks(1);
+    cur_ = blocks_.empty() ? nullptr : block_ + blocks_.back().size;
+  }
+
+  const Stats &GetStats() const { return stats_; }
+
+ private:
+  struct Block {
+    uint8_t *p;
+    size_t size;
+  };
+
+  static uint8_t *AlignDown(uint8_t *p) {
+    return reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(p) &
+                                       ~(FLATBUFFERS_MAX_ALIGNMENT - 1));
+  }
+
+  void AddBlock(size_t min_size) {
+    Block block = { nullptr, (std::max)(block_size_, min_size) };
+    block.p = Allocate(upstream_, block.size);
+    blocks_.push_back(block);
+    stats_.num_blocks++;
+    stats_.bytes_reserved += block.size;
+    block_ = block.p;
+    cur_ = block.p + block.size;
+  }
+
+  // Frees all but the `keep` most recent blocks.
+  void FreeBlocks(size_t keep) {
+    if (blocks_.size() <= keep) return;
+    auto first_kept = blocks_.end() - static_cast<ptrdiff_t>(keep);
+    for (auto it = blocks_.begin(); it != first_kept; ++it) {
+      Deallocate(upstream_, it->p, it->size);
+      stats_.num_blocks--;
+      stats_.bytes_reserved -= it->size;
+    }
+    blocks_.erase(blocks_.begin(), first_kept);
+    if (blocks_.empty()) block_ = cur_ = nullptr;
+  }
+
+  size_t block_size_;
+  Allocator *upstream_;
+  std::vector<Block> blocks_;
+  uint8_t *block_;  // Start of the current block.
+  uint8_t *cur_;    // Start of the most recent allocation.
+  Stats stats_;
+
+  // You shouldn't be copying instances of this class.
+  FLATBUFFERS_DELETE_FUNC(ArenaAllocator(const ArenaAllocator &));
+  FLATBUFFERS_DELETE_FUNC(ArenaAllocator &operator=(const ArenaAllocator &));
+};
+
 // DetachedBuffer is a finished flatbuffer memory region, detached from its
 // builder. The original memory region and allocator are also stored so that
 // the DetachedBuffer can manage the memory lifetime.
@@ -853,12 +1420,66 @@ class DetachedBuffer {
   }
 };
 
+// clang-format off
+#ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+  #define FLATBUFFERS_BUILDER_STAT(expr) expr
+#else
+  #define FLATBUFFERS_BUILDER_STAT(expr)
+#endif
+// clang-format on
+
+// Counters describing the work done by a FlatBufferBuilder, to find out why
+// some buffers are slow to build. Only collected if
+// FLATBUFFERS_TRACK_BUILDER_STATS is defined.
+struct BuilderStats {
+  BuilderStats()
+      : reallocations(0),
+        bytes_moved(0),
+        vtables_written(0),
+        vtables_deduped(0),
+        shared_string_hits(0),
+        shared_string_misses(0),
+        shared_object_hits(0),
+        shared_object_misses(0),
+        padding_bytes(0),
+        peak_scratch_size(0) {}
+
+  size_t reallocations;         // Times the buffer had to grow.
+  size_t bytes_moved;           // Bytes copied to grow or flatten the buffer.
+  size_t vtables_written;       // Vtables that were kept.
+  size_t vtables_deduped;       // Vtables replaced by an identical one.
+  size_t shared_string_hits;    // CreateSharedString calls that found one.
+  size_t shared_string_misses;  // CreateSharedString calls that wrote one.
+  size_t shared_object_hits;    // Shared vectors and tables found.
+  size_t shared_object_misses;  // Shared vectors and tables written.
+  size_t padding_bytes;         // Alignment padding, see Align/PreAlign.
+  size_t peak_scratch_size;     // Most bytes used by vtable and field lists.
+
+  // Combines the counters of several builders, e.g. of different threads.
+  BuilderStats &operator+=(const BuilderStats &other) {
+    reallocations += other.reallocations;
+    bytes_moved += other.bytes_moved;
+    vtables_written += other.vtables_written;
+    vtables_deduped += other.vtables_deduped;
+    shared_string_hits += other.shared_string_hits;
+    shared_string_misses += other.shared_string_misses;
+    shared_object_hits += other.shared_object_hits;
+    shared_object_misses += other.shared_object_misses;
+    padding_bytes += other.padding_bytes;
+    peak_scratch_size = (std::max)(peak_scratch_size, other.peak_scratch_size);
+    return *this;
+  }
+};
+
 // This is a minimal replication of std::vector<uint8_t> functionality,
 // except growing from higher to lower addresses. i.e push_back() inserts data
 // in the lowest address in the vector.
 // Since this vector leaves the lower part unused, we support a "scratch-pad"
 // that can be stored there for temporary data, to share the allocated space.
 // Essentially, this supports 2 std::vectors in a single buffer.
+// In segmented mode, the vector grows by starting a new memory block rather
+// than by copying everything to a larger one. Offsets (distances from the end
+// of the buffer) stay valid across blocks, see data_at().
 class vector_downward {
  public:
   explicit vector_downward(size_t initial_size, Allocator *allocator,
@@ -870,7 +1491,13 @@ class vector_downward {
         reserved_(0),
         buf_(nullptr),
         cur_(nullptr),
-        scratch_(nullptr) {}
+        scratch_(nullptr),
+        segmented_(false),
+        base_(0),
+        sealed_size_(0),
+        object_start_(0),
+        region64_(0),
+        in_region64_(false) {}
 
   // clang-format off
   #if !defined(FLATBUFFERS_CPP98_STL)
@@ -886,15 +1513,33 @@ class vector_downward {
         reserved_(other.reserved_),
         buf_(other.buf_),
         cur_(other.cur_),
-        scratch_(other.scratch_) {
+        scratch_(other.scratch_),
+        segmented_(other.segmented_),
+        base_(other.base_),
+        sealed_size_(other.sealed_size_),
+        object_start_(other.object_start_),
+        region64_(other.region64_),
+        in_region64_(other.in_region64_) {
+    // clang-format off
+    #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+      stats_ = other.stats_;
+    #endif
+    // clang-format on
     // No change in other.allocator_
     // No change in other.initial_size_
     // No change in other.buffer_minalign_
+    // No change in other.segmented_
+    segments_.swap(other.segments_);
     other.own_allocator_ = false;
     other.reserved_ = 0;
     other.buf_ = nullptr;
     other.cur_ = nullptr;
     other.scratch_ = nullptr;
+    other.base_ = 0;
+    other.sealed_size_ = 0;
+    other.object_start_ = 0;
+    other.region64_ = 0;
+    other.in_region64_ = false;
   }
 
   // clang-format off
@@ -921,12 +1566,17 @@ class vector_downward {
   }
 
   void clear() {
+    clear_segments();
     if (buf_) {
       cur_ = buf_ + reserved_;
     } else {
       reserved_ = 0;
       cur_ = nullptr;
     }
+    base_ = 0;
+    object_start_ = 0;
+    region64_ = 0;
+    in_region64_ = false;
     clear_scratch();
   }
 
@@ -939,12 +1589,14 @@ class vector_downward {
   }
 
   void clear_buffer() {
+    clear_segments();
     if (buf_) Deallocate(allocator_, buf_, reserved_);
     buf_ = nullptr;
   }
 
   // Relinquish the pointer to the caller.
   uint8_t *release_raw(size_t &allocated_bytes, size_t &offset) {
+    flatten();
     auto *buf = buf_;
     allocated_bytes = reserved_;
     offset = static_cast<size_t>(cur_ - buf_);
@@ -958,9 +1610,10 @@ class vector_downward {
 
   // Relinquish the pointer to the caller.
   DetachedBuffer release() {
+    flatten();
     // allocator ownership (if any) is transferred to DetachedBuffer.
     DetachedBuffer fb(allocator_, own_allocator_, buf_, reserved_, cur_,
-                      size());
+                      full_size());
     if (own_allocator_) {
       allocator_ = nullptr;
       own_allocator_ = false;
@@ -974,8 +1627,12 @@ class vector_downward {
     FLATBUFFERS_ASSERT(cur_ >= scratch_ && scratch_ >= buf_);
     if (len > static_cast<size_t>(cur_ - scratch_)) { reallocate(len); }
     // Beyond this, signed offsets may not have enough range:
-    // (FlatBuffers > 2GB not supported).
-    FLATBUFFERS_ASSERT(size() < FLATBUFFERS_MAX_BUFFER_SIZE);
+    // (FlatBuffers > 2GB not supported, except for the data referred to by
+    // 64-bit offsets at the end of the buffer).
+    FLATBUFFERS_ASSERT(in_region64_
+                           ? full_size() < FLATBUFFERS_MAX_64_BUFFER_SIZE
+                           : full_size() - region64_ <
+                                 FLATBUFFERS_MAX_BUFFER_SIZE);
     return len;
   }
 
@@ -988,8 +1645,24 @@ class vector_downward {
   // Returns nullptr if using the DefaultAllocator.
   Allocator *get_custom_allocator() { return allocator_; }
 
+  // Capacity of the next buffer allocated from scratch.
+  void set_initial_size(size_t initial_size) { initial_size_ = initial_size; }
+
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    BuilderStats &stats() { return stats_; }
+    const BuilderStats &stats() const { return stats_; }
+  #endif
+  // clang-format on
+
+  // Size of the data written after the 64-bit region (see begin_region64()),
+  // which is what 32-bit offsets are relative to.
   uoffset_t size() const {
-    return static_cast<uoffset_t>(reserved_ - static_cast<size_t>(cur_ - buf_));
+    return static_cast<uoffset_t>(full_size() - region64_);
+  }
+
+  size_t full_size() const {
+    return base_ + reserved_ - static_cast<size_t>(cur_ - buf_);
   }
 
   uoffset_t scratch_size() const {
@@ -1013,7 +1686,85 @@ class vector_downward {
     return scratch_;
   }
 
-  uint8_t *data_at(size_t offset) const { return buf_ + reserved_ - offset; }
+  uint8_t *data_at(size_t offset) const {
+    offset += region64_;
+    if (segments_.empty() || offset > sealed_size_)
+      return buf_ + reserved_ - (offset - base_);
+    return segment_data_at(offset);
+  }
+
+  // Enables growing by adding memory blocks rather than reallocating.
+  void set_segmented(bool segmented) {
+    FLATBUFFERS_ASSERT(!region64_ && !in_region64_);
+    segmented_ = segmented;
+  }
+
+  // The data written between begin_region64() and end_region64() is only
+  // referred to by 64-bit offsets, so it may extend beyond the range of
+  // 32-bit ones. It must be at the end of the buffer: size() and data_at()
+  // only count what is written after it.
+  void begin_region64() {
+    FLATBUFFERS_ASSERT(!segmented_ && !in_region64_ && !size());
+    in_region64_ = true;
+  }
+
+  void end_region64() {
+    FLATBUFFERS_ASSERT(in_region64_);
+    in_region64_ = false;
+    region64_ = full_size();
+  }
+
+  bool in_region64() const { return in_region64_; }
+
+  size_t region64() const { return region64_; }
+
+  // True if all data is in a single memory block, i.e. data() points at the
+  // whole buffer. Only ever false in segmented mode, see flatten().
+  bool is_contiguous() const { return segments_.empty(); }
+
+  // Called by the builder before it starts writing a new object (table,
+  // vector, string). In segmented mode, whatever was written since then is
+  // moved along to a new memory block, so no object straddles two blocks.
+  void mark_object_start() { object_start_ = full_size(); }
+
+  // Returns the buffer as a list of contiguous blocks, ordered from its start
+  // (data()) to its end.
+  std::vector<flatbuffers::span<const uint8_t>> segments() const {
+    std::vector<flatbuffers::span<const uint8_t>> spans;
+    spans.push_back(
+        flatbuffers::span<const uint8_t>(cur_, full_size() - sealed_size_));
+    for (auto it = segments_.rbegin(); it != segments_.rend(); ++it) {
+      spans.push_back(flatbuffers::span<const uint8_t>(
+          it->data_at(it->end), it->end - it->begin));
+    }
+    return spans;
+  }
+
+  // Copies all blocks into a single one, if there is more than one.
+  void flatten() {
+    if (segments_.empty()) return;
+    auto old_size = full_size();
+    auto old_scratch_size = scratch_size();
+    auto new_reserved = old_size + old_scratch_size;
+    new_reserved =
+        (new_reserved + buffer_minalign_ - 1) & ~(buffer_minalign_ - 1);
+    auto new_buf = Allocate(allocator_, new_reserved);
+    FLATBUFFERS_BUILDER_STAT(stats_.bytes_moved += old_size + old_scratch_size);
+    auto spans = segments();
+    auto dest = new_buf + new_reserved - old_size;
+    for (auto it = spans.begin(); it != spans.end(); ++it) {
+      memcpy(dest, it->data(), it->size());
+      dest += it->size();
+    }
+    memcpy(new_buf, buf_, old_scratch_size);
+    clear_segments();
+    Deallocate(allocator_, buf_, reserved_);
+    buf_ = new_buf;
+    reserved_ = new_reserved;
+    base_ = 0;
+    cur_ = buf_ + reserved_ - old_size;
+    scratch_ = buf_ + old_scratch_size;
+  }
 
   void push(const uint8_t *bytes, size_t num) {
     if (num > 0) { memcpy(make_space(num), bytes, num); }
@@ -1029,6 +1780,9 @@ class vector_downward {
     ensure_space(sizeof(T));
     *reinterpret_cast<T *>(scratch_) = t;
     scratch_ += sizeof(T);
+    FLATBUFFERS_BUILDER_STAT(stats_.peak_scratch_size = (std::max)(
+                                 stats_.peak_scratch_size,
+                                 static_cast<size_t>(scratch_size())));
   }
 
   // fill() is most frequently called with small byte counts (<= 4),
@@ -1047,6 +1801,33 @@ class vector_downward {
   void pop(size_t bytes_to_remove) { cur_ += bytes_to_remove; }
   void scratch_pop(size_t bytes_to_remove) { scratch_ -= bytes_to_remove; }
 
+  // Drops everything written since full_size(), scratch_size() and region64()
+  // had the given values.
+  void rewind_to(size_t old_size, size_t old_scratch_size,
+                 size_t old_region64 = 0) {
+    FLATBUFFERS_ASSERT(old_size <= full_size() &&
+                       old_scratch_size <= scratch_size() &&
+                       old_region64 <= old_size);
+    region64_ = old_region64;
+    in_region64_ = false;
+    scratch_ = buf_ + old_scratch_size;
+    object_start_ = old_size;
+    if (old_size < sealed_size_) {
+      // The data at old_size lives in a sealed block. Blocks after it are
+      // dropped, and the one holding it is cut short there, so buf_ continues
+      // right after it.
+      while (!segments_.empty() && segments_.back().begin >= old_size) {
+        Deallocate(allocator_, segments_.back().buf, segments_.back().reserved);
+        segments_.pop_back();
+      }
+      if (!segments_.empty()) segments_.back().end = old_size;
+      sealed_size_ = segments_.empty() ? 0 : old_size;
+      base_ = old_size & ~(buffer_minalign_ - 1);
+      FLATBUFFERS_ASSERT(old_size - base_ + old_scratch_size <= reserved_);
+    }
+    cur_ = buf_ + reserved_ - (old_size - base_);
+  }
+
   void swap(vector_downward &other) {
     using std::swap;
     swap(allocator_, other.allocator_);
@@ -1057,6 +1838,18 @@ class vector_downward {
     swap(buf_, other.buf_);
     swap(cur_, other.cur_);
     swap(scratch_, other.scratch_);
+    swap(segmented_, other.segmented_);
+    swap(base_, other.base_);
+    swap(sealed_size_, other.sealed_size_);
+    swap(object_start_, other.object_start_);
+    swap(region64_, other.region64_);
+    swap(in_region64_, other.in_region64_);
+    segments_.swap(other.segments_);
+    // clang-format off
+    #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+      swap(stats_, other.stats_);
+    #endif
+    // clang-format on
   }
 
   void swap_allocator(vector_downward &other) {
@@ -1079,20 +1872,117 @@ class vector_downward {
   uint8_t *cur_;  // Points at location between empty (below) and used (above).
   uint8_t *scratch_;  // Points to the end of the scratchpad in use.
 
+  // A sealed memory block of a segmented vector, holding the data at offsets
+  // (begin, end].
+  struct Segment {
+    uint8_t *buf;
+    size_t reserved;
+    size_t base;
+    size_t begin;
+    size_t end;
+
+    uint8_t *data_at(size_t offset) const {
+      return buf + reserved - (offset - base);
+    }
+  };
+
+  bool segmented_;
+  // Offset (distance from the end of the buffer) that corresponds to the end
+  // of buf_. Only non-zero in segmented mode, where buf_ holds the offsets
+  // above sealed_size_ and segments_ the ones below.
+  size_t base_;
+  size_t sealed_size_;
+  size_t object_start_;  // full_size() when the last object was started.
+  std::vector<Segment> segments_;
+  size_t region64_;  // full_size() at the end of the 64-bit region.
+  bool in_region64_;
+
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    BuilderStats stats_;
+  #endif
+  // clang-format on
+
+  uint8_t *segment_data_at(size_t offset) const {
+    for (auto it = segments_.rbegin(); it != segments_.rend(); ++it) {
+      if (offset > it->begin) return it->data_at(offset);
+    }
+    FLATBUFFERS_ASSERT(false);  // Offset 0 refers to nothing.
+    return nullptr;
+  }
+
+  void clear_segments() {
+    for (auto it = segments_.begin(); it != segments_.end(); ++it) {
+      Deallocate(allocator_, it->buf, it->reserved);
+    }
+    segments_.clear();
+    sealed_size_ = 0;
+  }
+
   void reallocate(size_t len) {
+    if (segmented_ && buf_) {
+      add_segment(len);
+      return;
+    }
     auto old_reserved = reserved_;
-    auto old_size = size();
+    auto old_size = full_size();
     auto old_scratch_size = scratch_size();
     reserved_ +=
         (std::max)(len, old_reserved ? old_reserved / 2 : initial_size_);
     reserved_ = (reserved_ + buffer_minalign_ - 1) & ~(buffer_minalign_ - 1);
     if (buf_) {
+      FLATBUFFERS_BUILDER_STAT(auto old_end = reinterpret_cast<uintptr_t>(
+                                   buf_ + old_reserved));
       buf_ = ReallocateDownward(allocator_, buf_, old_reserved, reserved_,
-                                old_size, old_scratch_size);
+                                old_size - base_, old_scratch_size);
+      // Allocators that grow the block downwards (e.g. ArenaAllocator) keep
+      // the data at its end in place, and only move the scratch area.
+      FLATBUFFERS_BUILDER_STAT(stats_.reallocations++);
+      FLATBUFFERS_BUILDER_STAT(
+          stats_.bytes_moved +=
+          old_scratch_size +
+          (reinterpret_cast<uintptr_t>(buf_ + reserved_) == old_end
+               ? 0
+               : old_size - base_));
     } else {
       buf_ = Allocate(allocator_, reserved_);
     }
-    cur_ = buf_ + reserved_ - old_size;
+    cur_ = buf_ + reserved_ - (old_size - base_);
+    scratch_ = buf_ + old_scratch_size;
+  }
+
+  // Continues the buffer in a new block, sealing the current one. Only the
+  // object being written (if any) and the scratch area are copied over.
+  void add_segment(size_t len) {
+    auto old_size = full_size();
+    auto old_scratch_size = scratch_size();
+    auto open_start = (std::max)(object_start_, sealed_size_);
+    auto open_size = old_size - open_start;
+    // Keep the new block aligned with respect to the end of the buffer.
+    auto new_base = open_start & ~(buffer_minalign_ - 1);
+    auto top_pad = open_start - new_base;
+    auto new_reserved = reserved_ + (std::max)(len, reserved_ / 2);
+    new_reserved = (std::max)(new_reserved,
+                              top_pad + open_size + len + old_scratch_size);
+    new_reserved =
+        (new_reserved + buffer_minalign_ - 1) & ~(buffer_minalign_ - 1);
+    auto new_buf = Allocate(allocator_, new_reserved);
+    memcpy(new_buf + new_reserved - top_pad - open_size, cur_, open_size);
+    memcpy(new_buf, buf_, old_scratch_size);
+    FLATBUFFERS_BUILDER_STAT(stats_.reallocations++);
+    FLATBUFFERS_BUILDER_STAT(stats_.bytes_moved += open_size + old_scratch_size);
+    if (open_start > sealed_size_) {
+      Segment segment = { buf_, reserved_, base_, sealed_size_, open_start };
+      segments_.push_back(segment);
+      sealed_size_ = open_start;
+    } else {
+      // Nothing but the open object lives in this block.
+      Deallocate(allocator_, buf_, reserved_);
+    }
+    buf_ = new_buf;
+    reserved_ = new_reserved;
+    base_ = new_base;
+    cur_ = buf_ + reserved_ - (old_size - base_);
     scratch_ = buf_ + old_scratch_size;
   }
 };
@@ -1104,6 +1994,63 @@ inline voffset_t FieldIndexToOffset(voffset_t field_id) {
   return static_cast<voffset_t>((field_id + fixed_fields) * sizeof(voffset_t));
 }
 
+// FNV-1a over a byte range, used by the builder to index serialized data
+// (vtables, strings) by content. Not meant to be stable across versions.
+// Pass the hash of the preceding bytes to hash a sequence of ranges.
+inline uint32_t HashBytes(const uint8_t *bytes, size_t len,
+                          uint32_t hash = 0x811C9DC5) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+/// @cond FLATBUFFERS_INTERNAL
+// The hash of a key in the index of a vector with the `hash_index`
+// attribute. This is part of the format: it's FNV-1a (fnv1a_32) of the key.
+inline uint32_t HashIndexKey(const char *key, size_t len) {
+  uint32_t hash = 0x811C9DC5;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= static_cast<uint8_t>(key[i]);
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+/// @endcond
+
+// Looks up a table by its string key in a vector with the `hash_index`
+// attribute, as done by the generated `field_by_key_hashed()` accessors.
+// The index is an open addressing hash table of a power of two size larger
+// than the vector, with linear probing, holding the position of each table
+// plus one (0 for an empty slot). If the index is absent or can't be valid,
+// this falls back to a binary search of the vector.
+template<typename T>
+const T *LookupByKeyHashed(const Vector<Offset<T>> *vec,
+                           const Vector<uint32_t> *index, const char *key) {
+  if (!vec) return nullptr;
+  const auto size = vec->size();
+  const auto slots = index ? index->size() : 0;
+  if (slots <= size || (slots & (slots - 1))) return vec->LookupByKey(key);
+  const auto len = strlen(key);
+  const auto mask = slots - 1;
+  auto slot = HashIndexKey(key, len) & mask;
+  for (uoffset_t probes = 0; probes < slots; probes++) {
+    const auto pos = index->Get(slot);
+    if (!pos) return nullptr;  // Key not found.
+    if (pos > size) break;
+    const auto elem = vec->Get(pos - 1);
+    if (!ElementKeyReadable(elem)) return nullptr;
+    const String *elem_key = elem->GetKey();
+    if (elem_key->size() == len && !memcmp(elem_key->c_str(), key, len)) {
+      return elem;
+    }
+    slot = (slot + 1) & mask;
+  }
+  // A full or corrupt index.
+  return vec->LookupByKey(key);
+}
+
 template<typename T, typename Alloc>
 const T *data(const std::vector<T, Alloc> &v) {
   // Eventually the returned pointer gets passed down to memcpy, so
@@ -1120,6 +2067,40 @@ template<typename T, typename Alloc> T *data(std::vector<T, Alloc> &v) {
 
 /// @endcond
 
+/// @brief Learns how much memory a FlatBufferBuilder needs, so that builders
+/// for similar buffers can allocate it up front rather than growing their
+/// buffer step by step. Keep one per call site or root type, and pass it to
+/// `FlatBufferBuilder::UseSizeHint()`.
+/// The hint follows the largest buffer immediately, and decays towards the
+/// size of smaller buffers by 1/2^`decay_shift` of the difference per buffer,
+/// so an outlier does not keep large buffers around forever.
+/// @remark Not thread-safe: use one per thread, or synchronize access.
+class BufferSizeHint {
+ public:
+  explicit BufferSizeHint(size_t initial_size = 1024, unsigned decay_shift = 3)
+      : size_(initial_size), decay_shift_(decay_shift) {}
+
+  /// @brief The number of bytes a new buffer should reserve.
+  size_t Get() const { return size_; }
+
+  /// @brief Record the number of bytes a buffer needed.
+  void Update(size_t size) {
+    if (size >= size_) {
+      size_ = size;
+    } else {
+      size_ -= (size_ - size) >> decay_shift_;
+    }
+  }
+
+  /// @brief Whether a buffer of `capacity` bytes is large enough compared to
+  /// the hint that it should be freed rather than reused.
+  bool ShouldShrink(size_t capacity) const { return capacity / 4 > size_; }
+
+ private:
+  size_t size_;
+  unsigned decay_shift_;
+};
+
 /// @addtogroup flatbuffers_cpp_api
 /// @{
 /// @class FlatBufferBuilder
@@ -1154,7 +2135,13 @@ class FlatBufferBuilder {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
-        string_pool(nullptr) {
+        hash_vtables_(false),
+        dedup_tables_(false),
+        vtable_index_count_(0),
+        string_pool(nullptr),
+        object_pool(nullptr),
+        size_hint_(nullptr),
+        peak_size_(0) {
     EndianCheck();
   }
 
@@ -1173,7 +2160,13 @@ class FlatBufferBuilder {
       minalign_(1),
       force_defaults_(false),
       dedup_vtables_(true),
-      string_pool(nullptr) {
+      hash_vtables_(false),
+      dedup_tables_(false),
+      vtable_index_count_(0),
+      string_pool(nullptr),
+      object_pool(nullptr),
+      size_hint_(nullptr),
+      peak_size_(0) {
     EndianCheck();
     // Default construct and swap idiom.
     // Lack of delegating constructors in vs2010 makes it more verbose than needed.
@@ -1205,11 +2198,20 @@ class FlatBufferBuilder {
     swap(minalign_, other.minalign_);
     swap(force_defaults_, other.force_defaults_);
     swap(dedup_vtables_, other.dedup_vtables_);
+    swap(hash_vtables_, other.hash_vtables_);
+    swap(dedup_tables_, other.dedup_tables_);
+    vtable_index_.swap(other.vtable_index_);
+    swap(vtable_index_count_, other.vtable_index_count_);
+    fixed_vtables_.swap(other.fixed_vtables_);
     swap(string_pool, other.string_pool);
+    swap(object_pool, other.object_pool);
+    swap(size_hint_, other.size_hint_);
+    swap(peak_size_, other.peak_size_);
   }
 
   ~FlatBufferBuilder() {
     if (string_pool) delete string_pool;
+    if (object_pool) delete object_pool;
   }
 
   void Reset() {
@@ -1225,29 +2227,118 @@ class FlatBufferBuilder {
     nested = false;
     finished = false;
     minalign_ = 1;
+    ClearVTableIndex();
     if (string_pool) string_pool->clear();
+    if (object_pool) object_pool->clear();
+    peak_size_ = 0;
+    if (size_hint_) {
+      if (size_hint_->ShouldShrink(buf_.capacity())) buf_.reset();
+      buf_.set_initial_size(size_hint_->Get());
+    }
+  }
+
+  /// @brief The state of a FlatBufferBuilder at some point during
+  /// construction, as returned by `Mark()`.
+  struct Checkpoint {
+    uoffset_t size;
+    uoffset_t scratch_size;
+    size_t minalign;
+    size_t region64;
+  };
+
+  /// @brief Take a checkpoint, so that all objects created after this point
+  /// can later be discarded with `RewindTo()`. Must not be called while a
+  /// table or vector is under construction.
+  Checkpoint Mark() const {
+    FLATBUFFERS_ASSERT(!nested && !num_field_loc && !buf_.in_region64());
+    Checkpoint mark = { buf_.size(), buf_.scratch_size(), minalign_,
+                        buf_.region64() };
+    return mark;
+  }
+
+  /// @brief Discard all objects created since `mark` was taken, in time
+  /// proportional to their size. Offsets to these objects become invalid,
+  /// as do checkpoints taken after `mark`. `Finish()` and `Clear()`
+  /// invalidate all checkpoints.
+  /// @param[in] mark A checkpoint returned by `Mark()`.
+  void RewindTo(const Checkpoint &mark) {
+    NotNested();
+    FLATBUFFERS_ASSERT(mark.region64 + mark.size <= GetSize64() &&
+                       mark.scratch_size <= buf_.scratch_size());
+    auto num_vtables =
+        static_cast<uoffset_t>(mark.scratch_size / sizeof(uoffset_t));
+    for (; vtable_index_count_ > num_vtables; vtable_index_count_--) {
+      EraseVTableHashed(*reinterpret_cast<uoffset_t *>(
+          buf_.scratch_data() +
+          (vtable_index_count_ - 1) * sizeof(uoffset_t)));
+    }
+    if (size_hint_) TrackPeakSize();
+    // Nothing after the 64-bit region was pooled if it has changed since.
+    auto pooled = mark.region64 == buf_.region64() ? mark.size : 0;
+    if (string_pool) string_pool->RewindTo(pooled);
+    if (object_pool) object_pool->RewindTo(pooled);
+    for (auto it = fixed_vtables_.begin(); it != fixed_vtables_.end();) {
+      if (it->second > pooled) {
+        it = fixed_vtables_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    buf_.rewind_to(mark.region64 + mark.size, mark.scratch_size,
+                   mark.region64);
+    minalign_ = mark.minalign;
+    finished = false;
   }
 
   /// @brief The current size of the serialized buffer, counting from the end.
   /// @return Returns an `uoffset_t` with the current size of the buffer.
-  uoffset_t GetSize() const { return buf_.size(); }
+  /// @remark This excludes data referred to by 64-bit offsets, so once a
+  /// buffer containing such data is finished, use `GetSize64()` instead.
+  uoffset_t GetSize() const {
+    FLATBUFFERS_ASSERT(!finished || !buf_.region64());
+    return buf_.size();
+  }
+
+  /// @brief The current size of the serialized buffer including the data
+  /// referred to by 64-bit offsets (see `CreateVector64()`), which may
+  /// exceed the range of `GetSize()`.
+  size_t GetSize64() const { return buf_.full_size(); }
 
   /// @brief Get the serialized buffer (after you call `Finish()`).
   /// @return Returns an `uint8_t` pointer to the FlatBuffer data inside the
   /// buffer.
+  /// @remark With a segmented buffer, call `FlattenBuffer()` first.
   uint8_t *GetBufferPointer() const {
     Finished();
+    FLATBUFFERS_ASSERT(buf_.is_contiguous());
     return buf_.data();
   }
 
   /// @brief Get the serialized buffer (after you call `Finish()`) as a span.
   /// @return Returns a constructed flatbuffers::span that is a view over the
   /// FlatBuffer data inside the buffer.
+  /// @remark With a segmented buffer, call `FlattenBuffer()` first.
   flatbuffers::span<uint8_t> GetBufferSpan() const {
     Finished();
-    return flatbuffers::span<uint8_t>(buf_.data(), buf_.size());
+    FLATBUFFERS_ASSERT(buf_.is_contiguous());
+    return flatbuffers::span<uint8_t>(buf_.data(), buf_.full_size());
+  }
+
+  /// @brief Get the serialized buffer (after you call `Finish()`) as a list
+  /// of contiguous memory blocks, e.g. to pass to `writev()`. Unless the
+  /// buffer is segmented (see `SegmentedBuffer()`), there is just one.
+  /// @return Returns spans over the FlatBuffer data, in order. They remain
+  /// valid until the builder is modified.
+  std::vector<flatbuffers::span<const uint8_t>> GetBufferSegments() const {
+    Finished();
+    return buf_.segments();
   }
 
+  /// @brief Copy a segmented buffer into a single memory block, after which
+  /// `GetBufferPointer()` may be used. Does nothing if the buffer is already
+  /// contiguous.
+  void FlattenBuffer() { buf_.flatten(); }
+
   /// @brief Get a pointer to an unfinished buffer.
   /// @return Returns a `uint8_t` pointer to the unfinished buffer.
   uint8_t *GetCurrentBufferPointer() const { return buf_.data(); }
@@ -1315,6 +2406,138 @@ class FlatBufferBuilder {
   /// @param[in] dedup When set to `true`, dedup vtables.
   void DedupVtables(bool dedup) { dedup_vtables_ = dedup; }
 
+  /// @brief By default duplicate vtables are found by comparing against every
+  /// vtable written so far, which is quadratic in the number of distinct
+  /// vtables. A hash index makes each lookup O(1) at the cost of some extra
+  /// memory. The resulting buffer is identical either way.
+  /// @param[in] hashed When set to `true`, look up vtables through a hash
+  /// index. Only has an effect while vtables are deduped.
+  void DedupVtablesHashed(bool hashed) { hash_vtables_ = hashed; }
+
+  /// @brief By default every table is written to the buffer. With table
+  /// dedup, a table that is identical to an earlier one is dropped again,
+  /// and the offset of the earlier one is returned instead, like
+  /// `CreateSharedString` does for strings. Tables are identical if they
+  /// have the same vtable, the same inline data, and their offset fields
+  /// refer to the same objects, so subtrees are only shared if all their
+  /// strings, vectors and tables are (see `CreateSharedVector`). Tables
+  /// with 64-bit offset fields are never shared.
+  /// @param[in] dedup When set to `true`, dedup tables. Only has an effect
+  /// while vtables are deduped.
+  void DedupTables(bool dedup) { dedup_tables_ = dedup; }
+
+  /// @brief By default the buffer is a single memory block, which is copied
+  /// into a larger one whenever it runs out of space. A segmented buffer
+  /// instead grows by adding blocks, so data already written is never copied
+  /// (only an object under construction moves to the new block).
+  /// The finished buffer is available through `GetBufferSegments()`, or as a
+  /// single block after `FlattenBuffer()`. `Release()` flattens implicitly.
+  /// @remark Tables read back during construction may reference data in
+  /// other blocks, so `CreateVectorOfSortedTables` flattens the buffer, and
+  /// `GetTemporaryPointer` must not be used.
+  /// @param[in] segmented When set to `true`, grow by adding blocks.
+  void SegmentedBuffer(bool segmented) { buf_.set_segmented(segmented); }
+
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+  /// @brief Get the counters collected by this builder since it was created
+  /// or `ResetStats()` was last called. `Clear()` and `Reset()` keep them.
+  /// Use `BuilderStats::operator+=` to combine the counters of several
+  /// builders, e.g. one per thread.
+  /// @remark Only available if FLATBUFFERS_TRACK_BUILDER_STATS is defined.
+  const BuilderStats &GetStats() const { return buf_.stats(); }
+
+  /// @brief Zero the counters returned by `GetStats()`.
+  void ResetStats() { buf_.stats() = BuilderStats(); }
+  #endif
+  // clang-format on
+
+  /// @brief Size newly allocated buffers according to `hint`, and report
+  /// the memory needed for each finished buffer back to it. This applies to
+  /// the first allocation, and the ones after `Reset()`. `Clear()` frees the
+  /// buffer if it is much larger than the hint.
+  /// @param[in] hint A hint shared by builders of similar buffers, which must
+  /// outlive this builder, or `nullptr` to stop using it.
+  void UseSizeHint(BufferSizeHint *hint) {
+    size_hint_ = hint;
+    if (hint) buf_.set_initial_size(hint->Get());
+  }
+
+  /// @brief Make sure that at least `size` more bytes can be serialized
+  /// without growing the buffer. The space is shared by the data and the
+  /// bookkeeping of the builder, e.g. of the fields of a table being built,
+  /// so an upper bound such as the one returned by the generated
+  /// `GetPackedSizeUpperBound()` functions covers both.
+  /// @param[in] size The number of bytes to make room for.
+  void Reserve(size_t size) { buf_.ensure_space(size); }
+
+  /// @brief An upper bound of the bytes needed to serialize a string of
+  /// `len` bytes, including the builder's bookkeeping.
+  static size_t StringSizeUpperBound(size_t len) {
+    // Length prefix, terminator, and alignment to uoffset_t.
+    return len + 2 * sizeof(uoffset_t);
+  }
+
+  /// @brief An upper bound of the bytes needed to serialize a vector of
+  /// `len` elements of `elem_size` bytes each, aligned to `alignment`.
+  static size_t VectorSizeUpperBound(size_t len, size_t elem_size,
+                                     size_t alignment) {
+    return len * elem_size + (alignment - 1) + 2 * sizeof(uoffset_t) - 1;
+  }
+
+  /// @brief An upper bound of the bytes needed to serialize a table with
+  /// `num_fields` fields, whose inline data takes up at most `inline_size`
+  /// bytes including alignment, and a new vtable for it.
+  static size_t TableSizeUpperBound(size_t num_fields, size_t inline_size) {
+    // The soffset_t to the vtable and its alignment, the vtable, its entry
+    // in the list of vtables, and a FieldLoc per field while building.
+    return inline_size + 2 * sizeof(soffset_t) - 1 +
+           (num_fields + 2) * sizeof(voffset_t) + sizeof(uoffset_t) +
+           num_fields * sizeof(FieldLoc);
+  }
+
+  /// @brief Copy everything `child` has serialized so far into this builder.
+  /// A builder may only be used by one thread at a time, but independent
+  /// parts of a large buffer, e.g. groups of the tables of a long vector, can
+  /// be built by separate builders on separate threads, and be spliced into
+  /// one builder afterwards.
+  /// Offsets between the objects of `child` are relative, so its data is
+  /// copied as is. Its vtables are added to the ones this builder shares
+  /// between tables, unless they are duplicates.
+  /// @param[in] child A builder that is not in the middle of a table. It is
+  /// not modified, except to flatten it if it is segmented, and may be
+  /// `Clear()`ed and reused afterwards.
+  /// @return The value to add to offsets of objects in `child` to get their
+  /// offsets in this builder.
+  uoffset_t Splice(FlatBufferBuilder &child) {
+    NotNested();
+    FLATBUFFERS_ASSERT(&child != this && !child.nested);
+    FLATBUFFERS_ASSERT(!child.buf_.region64() && !child.buf_.in_region64());
+    child.FlattenBuffer();
+    auto size = child.GetSize();
+    // Offsets in `child` are aligned relative to its end, which is here.
+    Align(child.minalign_);
+    auto delta = GetSize();
+    PushBytes(child.buf_.data(), size);
+    if (dedup_vtables_) {
+      for (auto it = child.buf_.scratch_data(); it < child.buf_.scratch_end();
+           it += sizeof(uoffset_t)) {
+        auto vt_offset = *reinterpret_cast<uoffset_t *>(it) + delta;
+        if (!FindVTable(buf_.data_at(vt_offset))) {
+          buf_.scratch_push_small(vt_offset);
+        }
+      }
+    }
+    return delta;
+  }
+
+  /// @brief Splice `child` into this builder, see above, and return the
+  /// offset of its object `off` in this builder.
+  template<typename T>
+  Offset<T> Splice(FlatBufferBuilder &child, Offset<T> off) {
+    return Offset<T>(Splice(child) + off.o);
+  }
+
   /// @cond FLATBUFFERS_INTERNAL
   void Pad(size_t num_bytes) { buf_.fill(num_bytes); }
 
@@ -1324,7 +2547,9 @@ class FlatBufferBuilder {
 
   void Align(size_t elem_size) {
     TrackMinAlign(elem_size);
-    buf_.fill(PaddingBytes(buf_.size(), elem_size));
+    auto padding = PaddingBytes(GetSize64(), elem_size);
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().padding_bytes += padding);
+    buf_.fill(padding);
   }
 
   void PushFlatBuffer(const uint8_t *bytes, size_t size) {
@@ -1357,8 +2582,9 @@ class FlatBufferBuilder {
 
   // When writing fields, we track where they are, so we can create correct
   // vtables later.
-  void TrackField(voffset_t field, uoffset_t off) {
-    FieldLoc fl = { off, field };
+  void TrackField(voffset_t field, uoffset_t off, bool is_offset = false,
+                  bool is_offset64 = false) {
+    FieldLoc fl = { off, field, is_offset, is_offset64 };
     buf_.scratch_push_small(fl);
     num_field_loc++;
     max_voffset_ = (std::max)(max_voffset_, field);
@@ -1379,7 +2605,13 @@ class FlatBufferBuilder {
 
   template<typename T> void AddOffset(voffset_t field, Offset<T> off) {
     if (off.IsNull()) return;  // Don't store.
-    AddElement(field, ReferTo(off.o), static_cast<uoffset_t>(0));
+    TrackField(field, PushElement(ReferTo(off.o)), true);
+  }
+
+  template<typename T> void AddOffset(voffset_t field, Offset64<T> off) {
+    if (off.IsNull()) return;  // Don't store.
+    // Tables with such fields are never shared by DedupTables().
+    TrackField(field, PushElement(ReferTo64(off.o)), false, true);
   }
 
   template<typename T> void AddStruct(voffset_t field, const T *structptr) {
@@ -1404,6 +2636,14 @@ class FlatBufferBuilder {
     return GetSize() - off + static_cast<uoffset_t>(sizeof(uoffset_t));
   }
 
+  // Same for 64-bit offsets, which count from the end of the 64-bit region.
+  uoffset64_t ReferTo64(uoffset64_t off) {
+    Align(sizeof(uoffset64_t));
+    // Offset must refer to something in the 64-bit region.
+    FLATBUFFERS_ASSERT(off && off <= buf_.region64());
+    return GetSize64() - off + sizeof(uoffset64_t);
+  }
+
   void NotNested() {
     // If you hit this, you're trying to construct a Table/Vector/String
     // during the construction of its parent table (between the MyTableBuilder
@@ -1422,6 +2662,7 @@ class FlatBufferBuilder {
   // with a sequence of AddElement calls in between.
   uoffset_t StartTable() {
     NotNested();
+    buf_.mark_object_start();
     nested = true;
     return GetSize();
   }
@@ -1460,26 +2701,45 @@ class FlatBufferBuilder {
           !ReadScalar<voffset_t>(buf_.data() + field_location->id));
       WriteScalar<voffset_t>(buf_.data() + field_location->id, pos);
     }
+    // The field locations and this vtable may be dropped again, but the
+    // buffer had to hold them.
+    if (size_hint_) TrackPeakSize();
+    auto share = dedup_tables_;
+    if (share) {
+      table_offset_fields_.clear();
+      for (auto it = buf_.scratch_end() - num_field_loc * sizeof(FieldLoc);
+           it < buf_.scratch_end(); it += sizeof(FieldLoc)) {
+        auto field_location = reinterpret_cast<FieldLoc *>(it);
+        // A 64-bit offset is relative to where it is stored, and its target
+        // can't be compared as that of 32-bit ones: equal bytes in two
+        // tables may refer to different data.
+        if (field_location->is_offset64) share = false;
+        if (field_location->is_offset) {
+          table_offset_fields_.push_back(
+              static_cast<voffset_t>(vtableoffsetloc - field_location->off));
+        }
+      }
+      std::sort(table_offset_fields_.begin(), table_offset_fields_.end());
+    }
     ClearOffsets();
-    auto vt1 = reinterpret_cast<voffset_t *>(buf_.data());
-    auto vt1_size = ReadScalar<voffset_t>(vt1);
     auto vt_use = GetSize();
     // See if we already have generated a vtable with this exact same
     // layout before. If so, make it point to the old one, remove this one.
     if (dedup_vtables_) {
-      for (auto it = buf_.scratch_data(); it < buf_.scratch_end();
-           it += sizeof(uoffset_t)) {
-        auto vt_offset_ptr = reinterpret_cast<uoffset_t *>(it);
-        auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*vt_offset_ptr));
-        auto vt2_size = ReadScalar<voffset_t>(vt2);
-        if (vt1_size != vt2_size || 0 != memcmp(vt2, vt1, vt1_size)) continue;
-        vt_use = *vt_offset_ptr;
+      auto existing = FindVTable(buf_.data());
+      if (existing) {
+        vt_use = existing;
         buf_.pop(GetSize() - vtableoffsetloc);
-        break;
       }
     }
     // If this is a new vtable, remember it.
-    if (vt_use == GetSize()) { buf_.scratch_push_small(vt_use); }
+    if (vt_use == GetSize()) {
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().vtables_written++);
+      buf_.scratch_push_small(vt_use);
+      if (dedup_vtables_ && hash_vtables_) SyncVTableIndex();
+    } else {
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().vtables_deduped++);
+    }
     // Fill the vtable offset we created above.
     // The offset points from the beginning of the object to where the
     // vtable is stored.
@@ -1490,6 +2750,7 @@ class FlatBufferBuilder {
                     static_cast<soffset_t>(vtableoffsetloc));
 
     nested = false;
+    if (share) return ShareTable(start, vtableoffsetloc);
     return vtableoffsetloc;
   }
 
@@ -1498,6 +2759,66 @@ class FlatBufferBuilder {
     return EndTable(start);
   }
 
+  // Tables whose layout is known at compile time (see the
+  // `precomputed_vtable` attribute) skip StartTable/AddElement/EndTable:
+  // StartFixedTable returns `size` bytes of space for the whole table, which
+  // starts with the vtable offset, and into which generated code stores the
+  // fields directly. EndFixedTable then makes the table refer to `vtable`,
+  // which must be a static array, and which is only written to the buffer
+  // once (or not at all, if an equal vtable already exists).
+  uint8_t *StartFixedTable(size_t size, size_t alignment) {
+    NotNested();
+    buf_.mark_object_start();
+    Align(alignment);
+    return buf_.make_space(size);
+  }
+
+  template<typename T>
+  static void SetFixedStruct(uint8_t *table, voffset_t field,
+                             const T *structptr) {
+    if (structptr) {
+      memcpy(table + field, structptr, sizeof(T));
+    } else {
+      memset(table + field, 0, sizeof(T));
+    }
+  }
+
+  uoffset_t EndFixedTable(const voffset_t *vtable) {
+    auto table = GetSize();
+    uoffset_t vt_use = 0;
+    for (auto it = fixed_vtables_.begin(); it != fixed_vtables_.end(); ++it) {
+      if (it->first == vtable) {
+        vt_use = it->second;
+        break;
+      }
+    }
+    if (vt_use) {
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().vtables_deduped++);
+    } else {
+      auto vt_size = vtable[0] / sizeof(voffset_t);
+      for (auto i = vt_size; i > 0; i--) PushElement<voffset_t>(vtable[i - 1]);
+      if (size_hint_) TrackPeakSize();
+      if (dedup_vtables_) vt_use = FindVTable(buf_.data());
+      if (vt_use) {
+        FLATBUFFERS_BUILDER_STAT(buf_.stats().vtables_deduped++);
+        buf_.pop(GetSize() - table);
+      } else {
+        FLATBUFFERS_BUILDER_STAT(buf_.stats().vtables_written++);
+        vt_use = GetSize();
+        buf_.scratch_push_small(vt_use);
+        if (dedup_vtables_ && hash_vtables_) SyncVTableIndex();
+      }
+      fixed_vtables_.push_back(std::make_pair(vtable, vt_use));
+    }
+    WriteScalar(buf_.data_at(table),
+                static_cast<soffset_t>(vt_use) - static_cast<soffset_t>(table));
+    if (dedup_tables_) {
+      table_offset_fields_.clear();
+      return ShareTable(table - vtable[1], table);
+    }
+    return table;
+  }
+
   // This checks a required field has been set in a given table that has
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field);
@@ -1515,11 +2836,31 @@ class FlatBufferBuilder {
     max_voffset_ = 0;
   }
 
+  // Starts an object in the 64-bit region of the buffer, which is ended by
+  // EndRegion64(). `len` is the length prefix of the object, which is still
+  // a uoffset_t.
+  void StartRegion64(size_t len) {
+    NotNested();
+    FLATBUFFERS_ASSERT(static_cast<uoffset_t>(len) == len);
+    (void)len;
+    // If this hits, an object not referred to by a 64-bit offset was created
+    // before this one.
+    FLATBUFFERS_ASSERT(!GetSize());
+    buf_.begin_region64();
+  }
+
+  template<typename T> Offset64<T> EndRegion64() {
+    buf_.end_region64();
+    return Offset64<T>(GetSize64());
+  }
+
   // Aligns such that when "len" bytes are written, an object can be written
   // after it with "alignment" without padding.
   void PreAlign(size_t len, size_t alignment) {
     TrackMinAlign(alignment);
-    buf_.fill(PaddingBytes(GetSize() + len, alignment));
+    auto padding = PaddingBytes(GetSize64() + len, alignment);
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().padding_bytes += padding);
+    buf_.fill(padding);
   }
   template<typename T> void PreAlign(size_t len) {
     AssertScalarT<T>();
@@ -1533,6 +2874,7 @@ class FlatBufferBuilder {
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateString(const char *str, size_t len) {
     NotNested();
+    buf_.mark_object_start();
     PreAlign<uoffset_t>(len + 1);  // Always 0-terminated.
     buf_.fill(1);
     PushBytes(reinterpret_cast<const uint8_t *>(str), len);
@@ -1594,21 +2936,21 @@ class FlatBufferBuilder {
   /// @param[in] len The number of bytes that should be stored from `str`.
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateSharedString(const char *str, size_t len) {
-    if (!string_pool)
-      string_pool = new StringOffsetMap(StringOffsetCompare(buf_));
-    auto size_before_string = buf_.size();
-    // Must first serialize the string, since the set is all offsets into
-    // buffer.
-    auto off = CreateString(str, len);
-    auto it = string_pool->find(off);
+    if (!string_pool) string_pool = new OffsetPool();
+    // Look the contents up before serializing, so a duplicate costs no
+    // writes to the buffer at all.
+    auto hash = HashBytes(reinterpret_cast<const uint8_t *>(str), len);
+    auto existing =
+        string_pool->Find(hash, StringEqual(buf_, str, len));
     // If it exists we reuse existing serialized data!
-    if (it != string_pool->end()) {
-      // We can remove the string we serialized.
-      buf_.pop(buf_.size() - size_before_string);
-      return *it;
+    if (existing) {
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().shared_string_hits++);
+      return existing;
     }
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().shared_string_misses++);
+    auto off = CreateString(str, len);
     // Record this string for future use.
-    string_pool->insert(off);
+    string_pool->Insert(off.o, hash);
     return off;
   }
 
@@ -1659,6 +3001,7 @@ class FlatBufferBuilder {
 
   void StartVector(size_t len, size_t elemsize) {
     NotNested();
+    buf_.mark_object_start();
     nested = true;
     PreAlign<uoffset_t>(len * elemsize);
     PreAlign(len * elemsize, elemsize);  // Just in case elemsize > uoffset_t.
@@ -1739,6 +3082,51 @@ class FlatBufferBuilder {
     return Offset<Vector<uint8_t>>(EndVector(v.size()));
   }
 
+  /// @brief Serialize an array into a FlatBuffer `vector`, unless a vector
+  /// with the same contents has been serialized with `CreateSharedVector`
+  /// before, in which case that one is returned instead.
+  /// @tparam T The data type of the array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<T>> CreateSharedVector(const T *v, size_t len) {
+    auto size = GetSize();
+    auto vec = CreateVector(v, len);
+    return ShareVector(size, vec.o, sizeof(T), sizeof(T));
+  }
+
+  /// @brief Serialize an array of offsets into a FlatBuffer `vector`, unless
+  /// a vector referring to the same objects has been serialized with
+  /// `CreateSharedVector` before, in which case that one is returned instead.
+  /// @tparam T The data type of the objects the offsets refer to.
+  /// @param[in] v A pointer to the array of offsets to serialize.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<Offset<T>>> CreateSharedVector(const Offset<T> *v,
+                                               size_t len) {
+    auto size = GetSize();
+    auto vec = CreateVector(v, len);
+    return ShareOffsetVector(size, vec.o);
+  }
+
+  /// @brief Serialize a `std::vector` into a FlatBuffer `vector`, unless one
+  /// with the same contents has been serialized with `CreateSharedVector`
+  /// before, in which case that one is returned instead.
+  /// @tparam T The data type of the `std::vector` elements.
+  /// @param v A const reference to the `std::vector` to serialize into the
+  /// buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<T>> CreateSharedVector(const std::vector<T> &v) {
+    return CreateSharedVector(data(v), v.size());
+  }
+
   // clang-format off
   #ifndef FLATBUFFERS_CPP98_STL
   /// @brief Serialize values returned by a function into a FlatBuffer `vector`.
@@ -1781,9 +3169,37 @@ class FlatBufferBuilder {
   /// where the vector is stored.
   Offset<Vector<Offset<String>>> CreateVectorOfStrings(
       const std::vector<std::string> &v) {
-    std::vector<Offset<String>> offsets(v.size());
-    for (size_t i = 0; i < v.size(); i++) offsets[i] = CreateString(v[i]);
-    return CreateVector(offsets);
+    return CreateVectorOfStrings(v.begin(), v.end());
+  }
+
+  /// @brief Serialize a range of strings into a FlatBuffer `vector`, with
+  /// the same result as calling `CreateString()` for each of them followed by
+  /// `CreateVector()`, but making space for all of it at once.
+  /// @tparam It A random access iterator to elements with `data()` and
+  /// `size()` methods, like `std::string` or `string_view`.
+  /// @param[in] begin The first string to serialize.
+  /// @param[in] end One past the last string to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename It>
+  Offset<Vector<Offset<String>>> CreateVectorOfStrings(It begin, It end) {
+    return CreateStrings(static_cast<size_t>(end - begin),
+                         StringRange<It>(begin));
+  }
+
+  /// @brief Serialize strings stored back to back in a single buffer into a
+  /// FlatBuffer `vector`, like `CreateVectorOfStrings(begin, end)`.
+  /// @param[in] arena The characters of all strings.
+  /// @param[in] offsets `count + 1` positions in `arena`, where string `i`
+  /// consists of the characters from `offsets[i]` up to `offsets[i + 1]`
+  /// (as in e.g. Arrow string columns).
+  /// @param[in] count The number of strings to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  Offset<Vector<Offset<String>>> CreateVectorOfStrings(const char *arena,
+                                                       const uoffset_t *offsets,
+                                                       size_t count) {
+    return CreateStrings(count, StringArena(arena, offsets));
   }
 
   /// @brief Serialize an array of structs into a FlatBuffer `vector`.
@@ -1885,17 +3301,114 @@ class FlatBufferBuilder {
     return CreateVectorOfNativeStructs<T, S>(data(v), v.size());
   }
 
-  /// @cond FLATBUFFERS_INTERNAL
-  template<typename T> struct StructKeyComparator {
-    bool operator()(const T &a, const T &b) const {
-      return a.KeyCompareLessThan(&b);
-    }
+  /// @brief Serialize an array into a FlatBuffer `vector` for a field with
+  /// the `offset64` attribute, which may make the buffer exceed 2GB.
+  /// Such vectors and strings are placed at the end of the buffer, so they
+  /// must all be created before any other object.
+  /// @tparam T The data type of the array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset64` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset64<Vector<T>> CreateVector64(const T *v, size_t len) {
+    StartRegion64(len);
+    CreateVector(v, len);
+    return EndRegion64<Vector<T>>();
+  }
 
-    FLATBUFFERS_DELETE_FUNC(
-        StructKeyComparator &operator=(const StructKeyComparator &));
-  };
+  /// @brief Serialize a `std::vector` into a FlatBuffer `vector` for a field
+  /// with the `offset64` attribute, see above.
+  template<typename T>
+  Offset64<Vector<T>> CreateVector64(const std::vector<T> &v) {
+    return CreateVector64(data(v), v.size());
+  }
+
+  Offset64<Vector<uint8_t>> CreateVector64(const std::vector<bool> &v) {
+    StartRegion64(v.size());
+    CreateVector(v);
+    return EndRegion64<Vector<uint8_t>>();
+  }
+
+  /// @brief Serialize an array of structs into a FlatBuffer `vector` for a
+  /// field with the `offset64` attribute, see `CreateVector64()`.
+  template<typename T>
+  Offset64<Vector<const T *>> CreateVectorOfStructs64(const T *v, size_t len) {
+    StartRegion64(len);
+    CreateVectorOfStructs(v, len);
+    return EndRegion64<Vector<const T *>>();
+  }
+
+  template<typename T, typename Alloc>
+  Offset64<Vector<const T *>> CreateVectorOfStructs64(
+      const std::vector<T, Alloc> &v) {
+    return CreateVectorOfStructs64(data(v), v.size());
+  }
+
+  /// @brief Store a string in the buffer for a field with the `offset64`
+  /// attribute, see `CreateVector64()`.
+  Offset64<String> CreateString64(const char *str, size_t len) {
+    StartRegion64(len);
+    CreateString(str, len);
+    return EndRegion64<String>();
+  }
+
+  /// @brief Store a null-terminated string in the buffer for a field with
+  /// the `offset64` attribute, see `CreateVector64()`.
+  Offset64<String> CreateString64(const char *str) {
+    return CreateString64(str, strlen(str));
+  }
+
+  /// @brief Store a string in the buffer for a field with the `offset64`
+  /// attribute. `T` is a std::string like type with support of T::c_str()
+  /// and T::length().
+  template<typename T> Offset64<String> CreateString64(const T &str) {
+    return CreateString64(str.c_str(), str.length());
+  }
+
+  /// @cond FLATBUFFERS_INTERNAL
+  // Like ForceVectorAlignment, for vectors created with CreateVector64.
+  void ForceVectorAlignment64(size_t len, size_t elemsize, size_t alignment) {
+    StartRegion64(len);
+    ForceVectorAlignment(len, elemsize, alignment);
+    buf_.end_region64();
+  }
   /// @endcond
 
+  /// @brief Serialize an array of structs into a FlatBuffer `vector`, unless
+  /// a vector with the same contents has been serialized with
+  /// `CreateSharedVectorOfStructs` before, in which case that one is
+  /// returned instead.
+  /// @tparam T The data type of the struct array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<const T *>> CreateSharedVectorOfStructs(const T *v,
+                                                        size_t len) {
+    auto size = GetSize();
+    auto vec = CreateVectorOfStructs(v, len);
+    return ShareVector(size, vec.o, sizeof(T), AlignOf<T>());
+  }
+
+  /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`,
+  /// unless a vector with the same contents has been serialized with
+  /// `CreateSharedVectorOfStructs` before, in which case that one is
+  /// returned instead.
+  /// @tparam T The data type of the `std::vector` struct elements.
+  /// @param[in] v A const reference to the `std::vector` of structs to
+  /// serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T, typename Alloc>
+  Offset<Vector<const T *>> CreateSharedVectorOfStructs(
+      const std::vector<T, Alloc> &v) {
+    return CreateSharedVectorOfStructs(data(v), v.size());
+  }
+
   /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`
   /// in sorted order.
   /// @tparam T The data type of the `std::vector` struct elements.
@@ -1932,7 +3445,7 @@ class FlatBufferBuilder {
   /// where the vector is stored.
   template<typename T>
   Offset<Vector<const T *>> CreateVectorOfSortedStructs(T *v, size_t len) {
-    std::sort(v, v + len, StructKeyComparator<T>());
+    SortStructs(v, len);
     return CreateVectorOfStructs(v, len);
   }
 
@@ -1955,23 +3468,6 @@ class FlatBufferBuilder {
     return CreateVectorOfSortedStructs<T>(vv, len);
   }
 
-  /// @cond FLATBUFFERS_INTERNAL
-  template<typename T> struct TableKeyComparator {
-    TableKeyComparator(vector_downward &buf) : buf_(buf) {}
-    TableKeyComparator(const TableKeyComparator &other) : buf_(other.buf_) {}
-    bool operator()(const Offset<T> &a, const Offset<T> &b) const {
-      auto table_a = reinterpret_cast<T *>(buf_.data_at(a.o));
-      auto table_b = reinterpret_cast<T *>(buf_.data_at(b.o));
-      return table_a->KeyCompareLessThan(table_b);
-    }
-    vector_downward &buf_;
-
-   private:
-    FLATBUFFERS_DELETE_FUNC(
-        TableKeyComparator &operator=(const TableKeyComparator &other));
-  };
-  /// @endcond
-
   /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
   /// in sorted order.
   /// @tparam T The data type that the offset refers to.
@@ -1983,7 +3479,7 @@ class FlatBufferBuilder {
   template<typename T>
   Offset<Vector<Offset<T>>> CreateVectorOfSortedTables(Offset<T> *v,
                                                        size_t len) {
-    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    SortTables(v, len);
     return CreateVector(v, len);
   }
 
@@ -2000,6 +3496,111 @@ class FlatBufferBuilder {
     return CreateVectorOfSortedTables(data(*v), v->size());
   }
 
+  /// @brief Serialize an array of structs into a FlatBuffer `vector` in
+  /// Eytzinger order, for fields with the `eytzinger` attribute.
+  /// @tparam T The data type of the struct array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`, in any order.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<const T *>> CreateVectorOfEytzingerStructs(const T *v,
+                                                           size_t len) {
+    std::vector<T> sorted(v, v + len);
+    SortStructs(data(sorted), len);
+    std::vector<T> layout(sorted);
+    ToEytzingerOrder(data(sorted), len, data(layout));
+    return CreateVectorOfStructs(data(layout), len);
+  }
+
+  /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`
+  /// in Eytzinger order, for fields with the `eytzinger` attribute.
+  /// @tparam T The data type of the `std::vector` struct elements.
+  /// @param[in] v A const reference to the `std::vector` of structs to
+  /// serialize into the buffer as a `vector`, in any order.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T, typename Alloc>
+  Offset<Vector<const T *>> CreateVectorOfEytzingerStructs(
+      const std::vector<T, Alloc> &v) {
+    return CreateVectorOfEytzingerStructs(data(v), v.size());
+  }
+
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order, for fields with the `eytzinger` attribute.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v An array of type `Offset<T>` that contains the `table`
+  /// offsets to store in the buffer, in any order.
+  /// @param[in] len The number of elements to store in the `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(const Offset<T> *v,
+                                                          size_t len) {
+    std::vector<Offset<T>> sorted(v, v + len);
+    SortTables(data(sorted), len);
+    std::vector<Offset<T>> layout(sorted);
+    ToEytzingerOrder(data(sorted), len, data(layout));
+    return CreateVector(layout);
+  }
+
+  /// @brief Serialize a `std::vector` of `table` offsets as a `vector` in the
+  /// buffer in Eytzinger order, for fields with the `eytzinger` attribute.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v A const reference to the `std::vector` of `table` offsets
+  /// to store in the buffer, in any order.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T>
+  Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(
+      const std::vector<Offset<T>> &v) {
+    return CreateVectorOfEytzingerTables(data(v), v.size());
+  }
+
+  /// @brief Serialize `table` offsets as a `vector` in the buffer in
+  /// Eytzinger order, where the tables are created by a callback.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] len The number of elements to store in the `vector`.
+  /// @param[in] f A function that takes the current iteration 0..len-1 and
+  /// the state, and returns the `Offset` of a table it creates.
+  /// @param[in] state State passed to f.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T, typename F, typename S>
+  Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(size_t len, F f,
+                                                          S *state) {
+    std::vector<Offset<T>> elems(len);
+    for (size_t i = 0; i < len; i++) elems[i] = f(i, state);
+    return CreateVectorOfEytzingerTables(elems);
+  }
+
+  /// @brief Serialize the hash index of a vector of tables with a string key,
+  /// for fields with the `hash_index` attribute (see `LookupByKeyHashed()`).
+  /// @tparam T The data type of the tables in the vector.
+  /// @param[in] vec The `Offset` of the vector, created before in this
+  /// buffer, usually with `CreateVectorOfSortedTables()`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the index is stored.
+  template<typename T>
+  Offset<Vector<uint32_t>> CreateKeyHashIndex(Offset<Vector<Offset<T>>> vec) {
+    // Keys are read through the tables, which may point across blocks.
+    buf_.flatten();
+    const auto v =
+        reinterpret_cast<const Vector<Offset<T>> *>(buf_.data_at(vec.o));
+    // At most half full, so probe sequences stay short.
+    uoffset_t slots = 1;
+    while (slots <= 2 * v->size()) slots *= 2;
+    std::vector<uint32_t> index(slots, 0);
+    for (uoffset_t i = 0; i < v->size(); i++) {
+      const String *key = v->Get(i)->GetKey();
+      auto slot = HashIndexKey(key->c_str(), key->size()) & (slots - 1);
+      while (index[slot]) slot = (slot + 1) & (slots - 1);
+      index[slot] = i + 1;
+    }
+    return CreateVector(index);
+  }
+
   /// @brief Specialized version of `CreateVector` for non-copying use cases.
   /// Write the data any time later to the returned buffer pointer `buf`.
   /// @param[in] len The number of elements to store in the `vector`.
@@ -2052,9 +3653,19 @@ class FlatBufferBuilder {
     return Offset<Vector<T>>(EndVector(len));
   }
 
+  /// @brief Same for a field with the `offset64` attribute, see
+  /// `CreateVector64()`.
+  template<typename T, typename U>
+  Offset64<Vector<T>> CreateVectorScalarCast64(const U *v, size_t len) {
+    StartRegion64(len);
+    CreateVectorScalarCast<T>(v, len);
+    return EndRegion64<Vector<T>>();
+  }
+
   /// @brief Write a struct by itself, typically to be part of a union.
   template<typename T> Offset<const T *> CreateStruct(const T &structobj) {
     NotNested();
+    buf_.mark_object_start();
     Align(AlignOf<T>());
     buf_.push_small(structobj);
     return Offset<const T *>(GetSize());
@@ -2095,7 +3706,10 @@ class FlatBufferBuilder {
 
   void Finish(uoffset_t root, const char *file_identifier, bool size_prefix) {
     NotNested();
+    buf_.mark_object_start();
+    if (size_hint_) TrackPeakSize();
     buf_.clear_scratch();
+    ClearVTableIndex();
     // This will cause the whole buffer to be aligned.
     PreAlign((size_prefix ? sizeof(uoffset_t) : 0) + sizeof(uoffset_t) +
                  (file_identifier ? kFileIdentifierLength : 0),
@@ -2106,13 +3720,29 @@ class FlatBufferBuilder {
                 kFileIdentifierLength);
     }
     PushElement(ReferTo(root));  // Location of root.
-    if (size_prefix) { PushElement(GetSize()); }
+    if (size_prefix) {
+      // The size prefix can't hold the size of a buffer with 64-bit offsets.
+      FLATBUFFERS_ASSERT(!buf_.region64());
+      PushElement(GetSize());
+    }
     finished = true;
+    if (size_hint_) {
+      size_hint_->Update((std::max)(peak_size_, GetSize64()));
+      peak_size_ = 0;
+    }
+  }
+
+  // For size_hint_: the largest amount of memory the buffer needed so far,
+  // where that is not evident from the finished buffer.
+  void TrackPeakSize() {
+    peak_size_ = (std::max)(peak_size_, GetSize64() + buf_.scratch_size());
   }
 
   struct FieldLoc {
     uoffset_t off;
     voffset_t id;
+    bool is_offset;    // Only needed by DedupTables().
+    bool is_offset64;  // Only needed by DedupTables().
   };
 
   vector_downward buf_;
@@ -2136,22 +3766,483 @@ class FlatBufferBuilder {
 
   bool dedup_vtables_;
 
-  struct StringOffsetCompare {
-    StringOffsetCompare(const vector_downward &buf) : buf_(&buf) {}
-    bool operator()(const Offset<String> &a, const Offset<String> &b) const {
-      auto stra = reinterpret_cast<const String *>(buf_->data_at(a.o));
-      auto strb = reinterpret_cast<const String *>(buf_->data_at(b.o));
-      return StringLessThan(stra->data(), stra->size(), strb->data(),
-                            strb->size());
+  bool hash_vtables_;  // Find duplicate vtables through vtable_index_.
+
+  bool dedup_tables_;
+  // Positions of the offset fields of the table being ended, see ShareTable.
+  std::vector<voffset_t> table_offset_fields_;
+
+  // Open-addressing hash set of vtable offsets (0 marks an empty slot), keyed
+  // by the vtable bytes. Mirrors the first vtable_index_count_ entries of the
+  // vtable list stored in the scratch area of buf_.
+  std::vector<uoffset_t> vtable_index_;
+  uoffset_t vtable_index_count_;
+
+  // Vtables written by EndFixedTable(), by the static array they came from.
+  std::vector<std::pair<const voffset_t *, uoffset_t>> fixed_vtables_;
+
+  void ClearVTableIndex() {
+    vtable_index_.clear();
+    vtable_index_count_ = 0;
+    fixed_vtables_.clear();
+  }
+
+  // Returns the offset of a vtable in the list with the same contents as
+  // `vt`, or 0 if there is none.
+  uoffset_t FindVTable(const uint8_t *vt) {
+    if (hash_vtables_) {
+      SyncVTableIndex();
+      return FindVTableHashed(vt);
+    }
+    auto vt_size = ReadScalar<voffset_t>(vt);
+    for (auto it = buf_.scratch_data(); it < buf_.scratch_end();
+         it += sizeof(uoffset_t)) {
+      auto vt_offset = *reinterpret_cast<uoffset_t *>(it);
+      auto vt2 = buf_.data_at(vt_offset);
+      if (vt_size == ReadScalar<voffset_t>(vt2) &&
+          0 == memcmp(vt2, vt, vt_size))
+        return vt_offset;
+    }
+    return 0;
+  }
+
+  // Returns the offset of a previously indexed vtable with the same contents
+  // as `vt`, or 0 if there is none.
+  uoffset_t FindVTableHashed(const uint8_t *vt) const {
+    if (vtable_index_.empty()) return 0;
+    auto vt_size = ReadScalar<voffset_t>(vt);
+    auto mask = vtable_index_.size() - 1;
+    for (auto i = HashBytes(vt, vt_size) & mask;; i = (i + 1) & mask) {
+      auto vt_offset = vtable_index_[i];
+      if (!vt_offset) return 0;
+      auto vt2 = buf_.data_at(vt_offset);
+      if (vt_size == ReadScalar<voffset_t>(vt2) &&
+          0 == memcmp(vt2, vt, vt_size))
+        return vt_offset;
     }
-    const vector_downward *buf_;
+  }
+
+  void InsertVTableHashed(uoffset_t vt_offset) {
+    auto mask = vtable_index_.size() - 1;
+    auto vt = buf_.data_at(vt_offset);
+    auto i = HashBytes(vt, ReadScalar<voffset_t>(vt)) & mask;
+    while (vtable_index_[i]) i = (i + 1) & mask;
+    vtable_index_[i] = vt_offset;
+  }
+
+  uoffset_t VTableHome(uoffset_t vt_offset) const {
+    auto vt = buf_.data_at(vt_offset);
+    return HashBytes(vt, ReadScalar<voffset_t>(vt)) &
+           static_cast<uoffset_t>(vtable_index_.size() - 1);
+  }
+
+  // Removes `vt_offset` from the index, if present, without leaving a
+  // tombstone: later entries of the same probe sequence move into the gap.
+  void EraseVTableHashed(uoffset_t vt_offset) {
+    auto mask = static_cast<uoffset_t>(vtable_index_.size() - 1);
+    auto i = VTableHome(vt_offset);
+    for (; vtable_index_[i] != vt_offset; i = (i + 1) & mask) {
+      if (!vtable_index_[i]) return;  // A duplicate that was never indexed.
+    }
+    for (auto j = (i + 1) & mask; vtable_index_[j]; j = (j + 1) & mask) {
+      // Move entry j up unless its home lies cyclically in (i, j].
+      if (((j - VTableHome(vtable_index_[j])) & mask) >= ((j - i) & mask)) {
+        vtable_index_[i] = vtable_index_[j];
+        i = j;
+      }
+    }
+    vtable_index_[i] = 0;
+  }
+
+  // Brings the index up to date with the vtable list in the scratch area,
+  // which may have grown while hashing was disabled, or been dropped by
+  // Finish().
+  void SyncVTableIndex() {
+    auto num_vtables =
+        static_cast<uoffset_t>(buf_.scratch_size() / sizeof(uoffset_t));
+    if (vtable_index_count_ > num_vtables) ClearVTableIndex();
+    for (; vtable_index_count_ < num_vtables; vtable_index_count_++) {
+      // Keep the load factor at or below 1/2.
+      if (2 * (vtable_index_count_ + 1) > vtable_index_.size()) {
+        std::vector<uoffset_t> old_index(
+            (std::max)(vtable_index_.size() * 2, static_cast<size_t>(16)), 0);
+        old_index.swap(vtable_index_);
+        for (auto it = old_index.begin(); it != old_index.end(); ++it) {
+          if (*it) InsertVTableHashed(*it);
+        }
+      }
+      auto vt_offset = *reinterpret_cast<uoffset_t *>(
+          buf_.scratch_data() + vtable_index_count_ * sizeof(uoffset_t));
+      // With dedup toggled off at some point, the list may hold duplicates;
+      // the index keeps the first one, just like the linear search.
+      if (!FindVTableHashed(buf_.data_at(vt_offset)))
+        InsertVTableHashed(vt_offset);
+    }
+  }
+
+  // For use with CreateSharedString and friends. Open-addressing hash set
+  // of the offsets of objects in buf_, keyed by their contents. The slot
+  // array is only ever grown, so its storage is reused across Clear().
+  class OffsetPool {
+   public:
+    OffsetPool() : num_entries_(0) {}
+
+    // Returns the offset of an object with the given hash for which
+    // `equal(offset)` holds, or 0.
+    template<typename Equal>
+    uoffset_t Find(uint32_t hash, const Equal &equal) const {
+      if (slots_.empty()) return 0;
+      auto mask = slots_.size() - 1;
+      for (auto i = hash & mask;; i = (i + 1) & mask) {
+        const Slot &slot = slots_[i];
+        if (!slot.off) return 0;
+        if (slot.hash == hash && equal(slot.off)) return slot.off;
+      }
+    }
+
+    void Insert(uoffset_t off, uint32_t hash) {
+      // Keep the load factor at or below 1/2.
+      if (2 * (num_entries_ + 1) > slots_.size()) Grow();
+      Place(off, hash);
+      num_entries_++;
+      inserted_.push_back(Slot(off, hash));
+    }
+
+    // Removes the objects at offsets above `size`, most recent first.
+    void RewindTo(uoffset_t size) {
+      while (!inserted_.empty() && inserted_.back().off > size) {
+        Erase(inserted_.back());
+        inserted_.pop_back();
+      }
+    }
+
+    void clear() {
+      std::fill(slots_.begin(), slots_.end(), Slot());
+      num_entries_ = 0;
+      inserted_.clear();
+    }
+
+   private:
+    struct Slot {
+      Slot() : off(0), hash(0) {}
+      Slot(uoffset_t _off, uint32_t _hash) : off(_off), hash(_hash) {}
+      uoffset_t off;  // 0 marks an empty slot.
+      uint32_t hash;  // Cached, to skip most memcmp calls and rehashing.
+    };
+
+    void Place(uoffset_t off, uint32_t hash) {
+      auto mask = slots_.size() - 1;
+      auto i = hash & mask;
+      while (slots_[i].off) i = (i + 1) & mask;
+      slots_[i].off = off;
+      slots_[i].hash = hash;
+    }
+
+    void Grow() {
+      std::vector<Slot> old_slots(
+          (std::max)(slots_.size() * 2, static_cast<size_t>(16)));
+      old_slots.swap(slots_);
+      for (auto it = old_slots.begin(); it != old_slots.end(); ++it) {
+        if (it->off) Place(it->off, it->hash);
+      }
+    }
+
+    // Removes an entry without leaving a tombstone, by moving later entries
+    // of the same probe sequence into the gap.
+    void Erase(const Slot &entry) {
+      auto mask = slots_.size() - 1;
+      auto i = entry.hash & mask;
+      while (slots_[i].off != entry.off) i = (i + 1) & mask;
+      for (auto j = (i + 1) & mask; slots_[j].off; j = (j + 1) & mask) {
+        auto home = slots_[j].hash & mask;
+        // Move slot j up unless its home lies cyclically in (i, j].
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+          slots_[i] = slots_[j];
+          i = j;
+        }
+      }
+      slots_[i] = Slot();
+      num_entries_--;
+    }
+
+    std::vector<Slot> slots_;
+    size_t num_entries_;
+    std::vector<Slot> inserted_;  // In order of insertion, for RewindTo().
+  };
+  OffsetPool *string_pool;
+  OffsetPool *object_pool;  // Vectors and tables, see CreateSharedVector.
+
+  // Compares the string at an offset with a string to be written.
+  struct StringEqual {
+    StringEqual(const vector_downward &buf, const char *str, size_t len)
+        : buf_(buf), str_(str), len_(len) {}
+    bool operator()(uoffset_t off) const {
+      auto s = reinterpret_cast<const String *>(buf_.data_at(off));
+      return s->size() == len_ && 0 == memcmp(s->data(), str_, len_);
+    }
+    const vector_downward &buf_;
+    const char *str_;
+    size_t len_;
+  };
+
+  // Compares the vector at an offset with the vector of scalars or structs
+  // at `vec`, byte for byte.
+  struct VectorEqual {
+    VectorEqual(const vector_downward &buf, uoffset_t vec, size_t num_bytes,
+                size_t alignment)
+        : buf_(buf), vec_(vec), num_bytes_(num_bytes), alignment_(alignment) {}
+    bool operator()(uoffset_t off) const {
+      // The elements must be as aligned as the ones of the new vector.
+      return (off - sizeof(uoffset_t)) % alignment_ == 0 &&
+             0 == memcmp(buf_.data_at(off), buf_.data_at(vec_),
+                         sizeof(uoffset_t) + num_bytes_);
+    }
+    const vector_downward &buf_;
+    uoffset_t vec_;
+    size_t num_bytes_;
+    size_t alignment_;
   };
 
-  // For use with CreateSharedString. Instantiated on first use only.
-  typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
-  StringOffsetMap *string_pool;
+  // Compares the vector at an offset with the vector of offsets at `vec`,
+  // by the objects the elements refer to.
+  struct OffsetVectorEqual {
+    OffsetVectorEqual(const vector_downward &buf, uoffset_t vec)
+        : buf_(buf), vec_(vec) {}
+    bool operator()(uoffset_t off) const {
+      auto len = ReadScalar<uoffset_t>(buf_.data_at(vec_));
+      if (ReadScalar<uoffset_t>(buf_.data_at(off)) != len) return false;
+      for (uoffset_t i = 0; i < len; i++) {
+        if (OffsetTarget(buf_, off, 1 + i) != OffsetTarget(buf_, vec_, 1 + i))
+          return false;
+      }
+      return true;
+    }
+    const vector_downward &buf_;
+    uoffset_t vec_;
+  };
+
+  // Compares the table at an offset with the table at `table`, whose offset
+  // fields are at the positions `offset_fields` (in ascending order). Fields
+  // are compared by the objects they refer to, everything else byte for
+  // byte. Only equal vtables make equal tables.
+  struct TableEqual {
+    TableEqual(const vector_downward &buf, uoffset_t table,
+               const std::vector<voffset_t> &offset_fields)
+        : buf_(buf), table_(table), offset_fields_(offset_fields) {}
+    bool operator()(uoffset_t off) const {
+      auto vt1 = VTableOf(buf_, table_);
+      auto vt2 = VTableOf(buf_, off);
+      auto vt_size = ReadScalar<voffset_t>(vt1);
+      if (vt_size != ReadScalar<voffset_t>(vt2) ||
+          0 != memcmp(vt1, vt2, vt_size))
+        return false;
+      auto t1 = buf_.data_at(table_);
+      auto t2 = buf_.data_at(off);
+      size_t pos = sizeof(soffset_t);
+      for (auto it = offset_fields_.begin(); it != offset_fields_.end();
+           ++it) {
+        if (0 != memcmp(t1 + pos, t2 + pos, *it - pos) ||
+            OffsetTarget(buf_, table_ - *it, 0) !=
+                OffsetTarget(buf_, off - *it, 0))
+          return false;
+        pos = *it + sizeof(uoffset_t);
+      }
+      auto object_size = ReadScalar<voffset_t>(vt1 + sizeof(voffset_t));
+      return 0 == memcmp(t1 + pos, t2 + pos, object_size - pos);
+    }
+    const vector_downward &buf_;
+    uoffset_t table_;
+    const std::vector<voffset_t> &offset_fields_;
+  };
+
+  // The object referred to by the `i`-th uoffset_t at `off`.
+  static uoffset_t OffsetTarget(const vector_downward &buf, uoffset_t off,
+                                uoffset_t i) {
+    auto field = off - i * static_cast<uoffset_t>(sizeof(uoffset_t));
+    return field - ReadScalar<uoffset_t>(buf.data_at(field));
+  }
+
+  static const uint8_t *VTableOf(const vector_downward &buf, uoffset_t table) {
+    return buf.data_at(table + ReadScalar<soffset_t>(buf.data_at(table)));
+  }
+
+  // If an object equal to the one just written at the end of the buffer, in
+  // the sense of `equal`, was recorded before, drops the new one (everything
+  // written since the buffer had `size` bytes) and returns the old one.
+  template<typename Equal>
+  uoffset_t ShareObject(uoffset_t size, uoffset_t off, uint32_t hash,
+                        const Equal &equal) {
+    if (!object_pool) object_pool = new OffsetPool();
+    auto existing = object_pool->Find(hash, equal);
+    if (existing) {
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().shared_object_hits++);
+      buf_.pop(GetSize() - size);
+      return existing;
+    }
+    FLATBUFFERS_BUILDER_STAT(buf_.stats().shared_object_misses++);
+    object_pool->Insert(off, hash);
+    return off;
+  }
+
+  uoffset_t ShareVector(uoffset_t size, uoffset_t vec, size_t elem_size,
+                        size_t alignment) {
+    auto num_bytes = ReadScalar<uoffset_t>(buf_.data_at(vec)) * elem_size;
+    auto hash = HashBytes(buf_.data_at(vec), sizeof(uoffset_t) + num_bytes);
+    return ShareObject(size, vec, hash,
+                       VectorEqual(buf_, vec, num_bytes, alignment));
+  }
+
+  uoffset_t ShareOffsetVector(uoffset_t size, uoffset_t vec) {
+    auto len = ReadScalar<uoffset_t>(buf_.data_at(vec));
+    auto hash = HashBytes(buf_.data_at(vec), sizeof(uoffset_t));
+    for (uoffset_t i = 0; i < len; i++) {
+      auto target = OffsetTarget(buf_, vec, 1 + i);
+      hash = HashBytes(reinterpret_cast<const uint8_t *>(&target),
+                       sizeof(target), hash);
+    }
+    return ShareObject(size, vec, hash, OffsetVectorEqual(buf_, vec));
+  }
+
+  // Called at the end of EndTable in dedup_tables_ mode, with the positions
+  // of its offset fields in table_offset_fields_.
+  uoffset_t ShareTable(uoffset_t size, uoffset_t table) {
+    auto vt = VTableOf(buf_, table);
+    auto hash = HashBytes(vt, ReadScalar<voffset_t>(vt));
+    auto t = buf_.data_at(table);
+    size_t pos = sizeof(soffset_t);
+    for (auto it = table_offset_fields_.begin();
+         it != table_offset_fields_.end(); ++it) {
+      auto target = OffsetTarget(buf_, table - *it, 0);
+      hash = HashBytes(t + pos, *it - pos, hash);
+      hash = HashBytes(reinterpret_cast<const uint8_t *>(&target),
+                       sizeof(target), hash);
+      pos = *it + sizeof(uoffset_t);
+    }
+    auto object_size = ReadScalar<voffset_t>(vt + sizeof(voffset_t));
+    hash = HashBytes(t + pos, object_size - pos, hash);
+    // A new vtable was written after the table, so no equal table exists
+    // (unless vtables aren't deduped, in which case it is left alone).
+    if (GetSize() != table) {
+      if (!object_pool) object_pool = new OffsetPool();
+      object_pool->Insert(table, hash);
+      return table;
+    }
+    return ShareObject(size, table, hash,
+                       TableEqual(buf_, table, table_offset_fields_));
+  }
+
+  BufferSizeHint *size_hint_;
+  size_t peak_size_;
 
  private:
+  // String sources for CreateStrings().
+  template<typename It> struct StringRange {
+    explicit StringRange(It begin) : begin_(begin) {}
+    const char *data(size_t i) const { return begin_[i].data(); }
+    size_t size(size_t i) const { return begin_[i].size(); }
+    It begin_;
+  };
+
+  struct StringArena {
+    StringArena(const char *arena, const uoffset_t *offsets)
+        : arena_(arena), offsets_(offsets) {}
+    const char *data(size_t i) const { return arena_ + offsets_[i]; }
+    size_t size(size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+    const char *arena_;
+    const uoffset_t *offsets_;
+  };
+
+  // Writes `count` strings and a vector referring to them, laid out exactly
+  // as separate CreateString() and CreateVector() calls would, with a single
+  // allocation and without intermediate offsets.
+  template<typename S>
+  Offset<Vector<Offset<String>>> CreateStrings(size_t count, const S &strs) {
+    NotNested();
+    buf_.mark_object_start();
+    // Pads for the first string as CreateString() would, which leaves the
+    // buffer aligned for the others.
+    PreAlign<uoffset_t>(count ? strs.size(0) + 1 : 0);
+    size_t strings_size = 0;
+    for (size_t i = 0; i < count; i++) {
+      strings_size +=
+          sizeof(uoffset_t) + strs.size(i) + 1 + StringPadding(strs, i);
+    }
+    auto vector_size = (count + 1) * sizeof(uoffset_t);
+    auto dst = buf_.make_space(vector_size + strings_size);
+    WriteScalar(dst, static_cast<uoffset_t>(count));
+    // The first string ends up at the end, followed by the next, as if they
+    // were created in order.
+    auto str = dst + vector_size + strings_size;
+    for (size_t i = 0; i < count; i++) {
+      auto len = strs.size(i);
+      auto padding = StringPadding(strs, i);
+      FLATBUFFERS_BUILDER_STAT(buf_.stats().padding_bytes += padding);
+      str -= sizeof(uoffset_t) + len + 1 + padding;
+      WriteScalar(str, static_cast<uoffset_t>(len));
+      if (len) memcpy(str + sizeof(uoffset_t), strs.data(i), len);
+      memset(str + sizeof(uoffset_t) + len, 0, 1 + padding);
+      auto elem = dst + (i + 1) * sizeof(uoffset_t);
+      WriteScalar(elem, static_cast<uoffset_t>(str - elem));
+    }
+    return Offset<Vector<Offset<String>>>(GetSize());
+  }
+
+  // The padding after string `i` of CreateStrings(). That of the first one
+  // is added before it is made space for.
+  template<typename S> static size_t StringPadding(const S &strs, size_t i) {
+    return i ? PaddingBytes(strs.size(i) + 1, sizeof(uoffset_t)) : 0;
+  }
+
+  // Sorts structs with a key by that key.
+  template<typename T> void SortStructs(T *v, size_t len) {
+    SortStructs(v, len,
+                flatbuffers::integral_constant<bool,
+                                               HasGetKey<const T *>::value>());
+  }
+
+  template<typename T>
+  void SortStructs(T *v, size_t len,
+                   flatbuffers::integral_constant<bool, true>) {
+    SortByKey(v, len, [](const T &s) { return s.GetKey(); });
+  }
+
+  template<typename T>
+  void SortStructs(T *v, size_t len,
+                   flatbuffers::integral_constant<bool, false>) {
+    std::stable_sort(v, v + len, [](const T &a, const T &b) {
+      return a.KeyCompareLessThan(&b);
+    });
+  }
+
+  // Sorts offsets to tables with a key by that key.
+  template<typename T> void SortTables(Offset<T> *v, size_t len) {
+    // Keys are read through the tables, which may point across blocks.
+    buf_.flatten();
+    SortTables(v, len,
+               flatbuffers::integral_constant<bool,
+                                              HasGetKey<const T *>::value>());
+  }
+
+  template<typename T>
+  void SortTables(Offset<T> *v, size_t len,
+                  flatbuffers::integral_constant<bool, true>) {
+    // Extract all keys first, rather than go through the tables (and their
+    // vtables) on every comparison.
+    SortByKey(v, len, [&](const Offset<T> &o) {
+      return SortKeyOf(
+          reinterpret_cast<const T *>(buf_.data_at(o.o))->GetKey());
+    });
+  }
+
+  template<typename T>
+  void SortTables(Offset<T> *v, size_t len,
+                  flatbuffers::integral_constant<bool, false>) {
+    std::stable_sort(v, v + len, [&](const Offset<T> &a, const Offset<T> &b) {
+      return reinterpret_cast<const T *>(buf_.data_at(a.o))
+          ->KeyCompareLessThan(reinterpret_cast<const T *>(buf_.data_at(b.o)));
+    });
+  }
+
   // Allocates space for a vector of structures.
   // Must be completed with EndVectorOfStructs().
   template<typename T> T *StartVectorOfStructs(size_t vector_size) {
@@ -2219,11 +4310,100 @@ inline bool BufferHasIdentifier(const void *buf, const char *identifier,
                  FlatBufferBuilder::kFileIdentifierLength) == 0;
 }
 
+class Verifier;
+
+// clang-format off
+#ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+  #define FLATBUFFERS_VERIFIER_STAT(expr) expr
+#else
+  #define FLATBUFFERS_VERIFIER_STAT(expr)
+#endif
+// clang-format on
+
+// A step on the path from the root table to where verification failed: a
+// field of a table, as its vtable offset (see the generated VT_ constants),
+// and for vectors of tables or strings, the index of the element.
+struct VerifierPathStep {
+  voffset_t field;
+  uoffset_t index;
+};
+
+// Counters describing the work done by a Verifier, to find out why some
+// buffers are slow to verify or are rejected. Only collected if
+// FLATBUFFERS_TRACK_VERIFIER_STATS is defined.
+struct VerifierStats {
+  VerifierStats()
+      : buffers(0),
+        verify_ns(0),
+        tables(0),
+        max_depth(0),
+        vector_bytes(0),
+        string_bytes(0),
+        failed(false),
+        failure_offset(0) {}
+
+  size_t buffers;         // Buffers verified, e.g. by VerifyBuffer().
+  uint64_t verify_ns;     // Nanoseconds spent verifying them.
+  size_t tables;          // Tables verified.
+  size_t max_depth;       // Deepest nesting of tables reached.
+  size_t vector_bytes;    // Bytes of vectors checked, with their sizes.
+  size_t string_bytes;    // Bytes of strings checked, with their sizes.
+  bool failed;            // Whether a check failed. If so, the first:
+  size_t failure_offset;  // Offset in the buffer of the data it checked.
+  std::vector<VerifierPathStep> failure_path;  // Fields leading to it.
+
+  // Combines the counters of several verifiers, e.g. of all buffers of a
+  // root type to get the time spent on those. Keeps the first failure.
+  VerifierStats &operator+=(const VerifierStats &other) {
+    buffers += other.buffers;
+    verify_ns += other.verify_ns;
+    tables += other.tables;
+    max_depth = (std::max)(max_depth, other.max_depth);
+    vector_bytes += other.vector_bytes;
+    string_bytes += other.string_bytes;
+    if (!failed && other.failed) {
+      failed = true;
+      failure_offset = other.failure_offset;
+      failure_path = other.failure_path;
+    }
+    return *this;
+  }
+};
+
+/// @cond FLATBUFFERS_INTERNAL
+// Verifies the tables of large vectors in parallel, implemented by
+// ParallelVerification in flatbuffers/parallel_verifier.h.
+class VerifierParallelism {
+ public:
+  // Verifies elements [begin, end) of the vector at `vec`.
+  typedef bool (*ElementVerifier)(Verifier &verifier, const void *vec,
+                                  uoffset_t begin, uoffset_t end);
+
+  virtual ~VerifierParallelism() {}
+
+  // Vectors with fewer elements are verified on the calling thread.
+  virtual uoffset_t MinSize() const = 0;
+
+  // Verifies all `size` elements of `vec` with forks of `verifier`, and
+  // joins them.
+  virtual bool VerifyElements(Verifier &verifier, const void *vec,
+                              uoffset_t size, ElementVerifier verify) = 0;
+};
+/// @endcond
+
 // Helper class to verify the integrity of a FlatBuffer
 class Verifier FLATBUFFERS_FINAL_CLASS {
  public:
+  // With `_track_visited`, tables, vectors of tables and vectors of strings
+  // that are reached more than once (as in buffers using CreateSharedString
+  // or otherwise sharing offsets) are only verified the first time, so
+  // verification takes time linear in the buffer size, and `_max_tables`
+  // counts unique tables. This needs a bitmap of one bit per 4 bytes of
+  // buffer for each type of table reached. Shared tables are only checked
+  // against `_max_depth` at the depth they are first reached at.
   Verifier(const uint8_t *buf, size_t buf_len, uoffset_t _max_depth = 64,
-           uoffset_t _max_tables = 1000000, bool _check_alignment = true)
+           uoffset_t _max_tables = 1000000, bool _check_alignment = true,
+           bool _track_visited = false)
       : buf_(buf),
         size_(buf_len),
         depth_(0),
@@ -2231,8 +4411,18 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
         num_tables_(0),
         max_tables_(_max_tables),
         upper_bound_(0),
-        check_alignment_(_check_alignment) {
-    FLATBUFFERS_ASSERT(size_ < FLATBUFFERS_MAX_BUFFER_SIZE);
+        check_alignment_(_check_alignment),
+        track_visited_(_track_visited),
+        vtable_cache_hits_(0),
+        vtable_cache_misses_(0),
+        parallelism_(nullptr),
+        bytes_(0),
+        max_bytes_(~size_t(0)),
+        has_deadline_(false) {
+    FLATBUFFERS_ASSERT(size_ < FLATBUFFERS_MAX_64_BUFFER_SIZE);
+    FLATBUFFERS_VERIFIER_STAT(offset_ = 0);
+    // Outside any buffer, so never matches.
+    std::fill(vtable_cache_, vtable_cache_ + kVTableCacheSize, ~size_t(0));
   }
 
   // Central location where any verification failures register.
@@ -2245,6 +4435,16 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
       if (!ok)
         upper_bound_ = 0;
     #endif
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+      if (!ok && !stats_.failed) {
+        stats_.failed = true;
+        stats_.failure_offset = offset_;
+        stats_.failure_path.assign(
+            path_.begin(),
+            path_.begin() + (std::min)(static_cast<size_t>(depth_),
+                                       path_.size()));
+      }
+    #endif
     // clang-format on
     return ok;
   }
@@ -2258,10 +4458,12 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
         upper_bound_ =  upper_bound;
     #endif
     // clang-format on
+    FLATBUFFERS_VERIFIER_STAT(offset_ = elem);
     return Check(elem_len < size_ && elem <= size_ - elem_len);
   }
 
   template<typename T> bool VerifyAlignment(size_t elem) const {
+    FLATBUFFERS_VERIFIER_STAT(offset_ = elem);
     return Check((elem & (sizeof(T) - 1)) == 0 || !check_alignment_);
   }
 
@@ -2287,7 +4489,7 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Verify a pointer (may be NULL) of a table type.
   template<typename T> bool VerifyTable(const T *table) {
-    return !table || table->Verify(*this);
+    return !table || Visited<T>(table) || table->Verify(*this);
   }
 
   // Verify a pointer (may be NULL) of any vector type.
@@ -2301,36 +4503,61 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return VerifyVector(reinterpret_cast<const Vector<T> *>(vec));
   }
 
+  // Same for vectors referred to by 64-bit offsets, which may be larger.
+  template<typename T> bool VerifyVector64(const Vector<T> *vec) const {
+    return !vec ||
+           VerifyVectorOrString(reinterpret_cast<const uint8_t *>(vec),
+                                sizeof(T), nullptr,
+                                FLATBUFFERS_MAX_64_BUFFER_SIZE);
+  }
+
+  template<typename T>
+  bool VerifyVector64(const Vector<const T *> *vec) const {
+    return VerifyVector64(reinterpret_cast<const Vector<T> *>(vec));
+  }
+
   // Verify a pointer (may be NULL) to string.
-  bool VerifyString(const String *str) const {
+  bool VerifyString(const String *str,
+                    size_t max_size = FLATBUFFERS_MAX_BUFFER_SIZE) const {
     size_t end;
     return !str || (VerifyVectorOrString(reinterpret_cast<const uint8_t *>(str),
-                                         1, &end) &&
+                                         1, &end, max_size) &&
                     Verify(end, 1) &&           // Must have terminator
                     Check(buf_[end] == '\0'));  // Terminating byte must be 0.
   }
 
+  bool VerifyString64(const String *str) const {
+    return VerifyString(str, FLATBUFFERS_MAX_64_BUFFER_SIZE);
+  }
+
   // Common code between vectors and strings.
-  bool VerifyVectorOrString(const uint8_t *vec, size_t elem_size,
-                            size_t *end = nullptr) const {
+  bool VerifyVectorOrString(
+      const uint8_t *vec, size_t elem_size, size_t *end = nullptr,
+      size_t max_size = FLATBUFFERS_MAX_BUFFER_SIZE) const {
     auto veco = static_cast<size_t>(vec - buf_);
     // Check we can read the size field.
     if (!Verify<uoffset_t>(veco)) return false;
     // Check the whole array. If this is a string, the byte past the array
     // must be 0.
     auto size = ReadScalar<uoffset_t>(vec);
-    auto max_elems = FLATBUFFERS_MAX_BUFFER_SIZE / elem_size;
+    auto max_elems = max_size / elem_size;
     if (!Check(size < max_elems))
       return false;  // Protect against byte_size overflowing.
     auto byte_size = sizeof(size) + elem_size * size;
     if (end) *end = veco + byte_size;
-    return Verify(veco, byte_size);
+    // Only strings ask for their end.
+    FLATBUFFERS_VERIFIER_STAT(
+        (end ? stats_.string_bytes : stats_.vector_bytes) += byte_size);
+    bytes_ += byte_size;
+    return Verify(veco, byte_size) && Check(bytes_ <= max_bytes_);
   }
 
   // Special case for string contents, after the above has been called.
   bool VerifyVectorOfStrings(const Vector<Offset<String>> *vec) const {
-    if (vec) {
+    if (vec && !Visited<Vector<Offset<String>>>(vec)) {
       for (uoffset_t i = 0; i < vec->size(); i++) {
+        FLATBUFFERS_VERIFIER_STAT(SetPathIndex(i));
+        if (i % kDeadlineInterval == 0 && !WithinDeadline()) return false;
         if (!VerifyString(vec->Get(i))) return false;
       }
     }
@@ -2339,9 +4566,16 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Special case for table contents, after the above has been called.
   template<typename T> bool VerifyVectorOfTables(const Vector<Offset<T>> *vec) {
-    if (vec) {
+    if (vec && !Visited<Vector<Offset<T>>>(vec)) {
+      // Visited objects are tracked per verifier, so forks can't skip them.
+      if (parallelism_ && !track_visited_ &&
+          vec->size() >= parallelism_->MinSize()) {
+        return parallelism_->VerifyElements(*this, vec, vec->size(),
+                                            VerifyTables<T>);
+      }
       for (uoffset_t i = 0; i < vec->size(); i++) {
-        if (!vec->Get(i)->Verify(*this)) return false;
+        FLATBUFFERS_VERIFIER_STAT(SetPathIndex(i));
+        if (!VerifyTable(vec->Get(i))) return false;
       }
     }
     return true;
@@ -2355,12 +4589,30 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     // This offset may be signed, but doing the subtraction unsigned always
     // gives the result we want.
     auto vtableo = tableo - static_cast<size_t>(ReadScalar<soffset_t>(table));
+    if (!VerifyComplexity()) return false;
+    // Most tables share a few vtables, which only need checking once.
+    auto &cached = vtable_cache_[(vtableo / sizeof(voffset_t)) %
+                                 kVTableCacheSize];
+    if (vtableo < size_ && cached == vtableo) {
+      vtable_cache_hits_++;
+      return true;
+    }
+    vtable_cache_misses_++;
     // Check the vtable size field, then check vtable fits in its entirety.
-    return VerifyComplexity() && Verify<voffset_t>(vtableo) &&
-           VerifyAlignment<voffset_t>(ReadScalar<voffset_t>(buf_ + vtableo)) &&
-           Verify(vtableo, ReadScalar<voffset_t>(buf_ + vtableo));
+    if (!(Verify<voffset_t>(vtableo) &&
+          VerifyAlignment<voffset_t>(ReadScalar<voffset_t>(buf_ + vtableo)) &&
+          Verify(vtableo, ReadScalar<voffset_t>(buf_ + vtableo)))) {
+      return false;
+    }
+    cached = vtableo;
+    return true;
   }
 
+  // The number of tables whose vtable was already checked for an earlier
+  // table, and the number of those whose vtable had to be checked.
+  size_t GetVTableCacheHits() const { return vtable_cache_hits_; }
+  size_t GetVTableCacheMisses() const { return vtable_cache_misses_; }
+
   template<typename T>
   bool VerifyBufferFromStart(const char *identifier, size_t start) {
     if (identifier && !Check((size_ >= 2 * sizeof(flatbuffers::uoffset_t) &&
@@ -2368,15 +4620,18 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
       return false;
     }
 
+    FLATBUFFERS_VERIFIER_STAT(auto began = std::chrono::steady_clock::now());
     // Call T::Verify, which must be in the generated code for this type.
     auto o = VerifyOffset(start);
-    return o && reinterpret_cast<const T *>(buf_ + start + o)->Verify(*this)
+    auto ok = o && reinterpret_cast<const T *>(buf_ + start + o)->Verify(*this)
     // clang-format off
     #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
            && GetComputedSize()
     #endif
         ;
     // clang-format on
+    FLATBUFFERS_VERIFIER_STAT(CountBuffer(began));
+    return ok;
   }
 
   // Verify this whole buffer, starting with root type T.
@@ -2409,6 +4664,20 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return VerifyOffset(static_cast<size_t>(base - buf_) + start);
   }
 
+  // Same for the offsets of fields with the `offset64` attribute.
+  size_t VerifyOffset64(size_t start) const {
+    if (!Verify<uoffset64_t>(start)) return 0;
+    auto o = ReadScalar<uoffset64_t>(buf_ + start);
+    // May not point to itself, must be inside the buffer.
+    if (!Check(o != 0 && o < size_)) return 0;
+    if (!Verify(start + static_cast<size_t>(o), 1)) return 0;
+    return static_cast<size_t>(o);
+  }
+
+  size_t VerifyOffset64(const uint8_t *base, voffset_t start) const {
+    return VerifyOffset64(static_cast<size_t>(base - buf_) + start);
+  }
+
   // Called at the start of a table to increase counters measuring data
   // structure depth and amount, and possibly bails out with false if
   // limits set by the constructor have been hit. Needs to be balanced
@@ -2416,7 +4685,18 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   bool VerifyComplexity() {
     depth_++;
     num_tables_++;
-    return Check(depth_ <= max_depth_ && num_tables_ <= max_tables_);
+    // clang-format off
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+      stats_.tables++;
+      stats_.max_depth = (std::max)(stats_.max_depth,
+                                    static_cast<size_t>(depth_));
+      if (path_.size() < depth_) path_.resize(depth_);
+      path_[depth_ - 1].field = 0;
+      path_[depth_ - 1].index = 0;
+    #endif
+    // clang-format on
+    return Check(depth_ <= max_depth_ && num_tables_ <= max_tables_) &&
+           (num_tables_ % kDeadlineInterval != 0 || WithinDeadline());
   }
 
   // Called at the end of a table to pop the depth count.
@@ -2425,6 +4705,132 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return true;
   }
 
+  // Whether the object of type T at `p` was reached before, when tracking
+  // visited objects. Marks it as reached otherwise. The same bytes may be
+  // referred to as different types in a malicious buffer, so there is a
+  // bitmap per type.
+  template<typename T> bool Visited(const void *p) const {
+    if (!track_visited_) return false;
+    auto o = static_cast<size_t>(reinterpret_cast<const uint8_t *>(p) - buf_);
+    // Objects start with a 32-bit offset or size, so are 4 byte aligned,
+    // unless not checking alignment. Not verified yet, so may be outside the
+    // buffer or misaligned, which verification will then catch.
+    const auto shift = check_alignment_ ? 2 : 0;
+    if (o >= size_ || (o & ((1u << shift) - 1))) return false;
+    o >>= shift;
+    auto &bits = VisitedBits(VisitedTag<T>(), (size_ >> shift) / 64 + 1);
+    const auto mask = static_cast<uint64_t>(1) << (o % 64);
+    if (bits[o / 64] & mask) return true;
+    bits[o / 64] |= mask;
+    return false;
+  }
+
+  // The number of tables verified so far.
+  uoffset_t GetNumTables() const { return num_tables_; }
+
+  // The number of tables that may still be verified.
+  uoffset_t GetTablesLeft() const {
+    return num_tables_ < max_tables_ ? max_tables_ - num_tables_ : 0;
+  }
+
+  // Called by the generated code before verifying each field of the current
+  // table, to tell where a failure was found (see VerifierStats).
+  void VerifyingField(voffset_t field) const {
+    // clang-format off
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+      if (depth_ && depth_ <= path_.size()) {
+        path_[depth_ - 1].field = field;
+        path_[depth_ - 1].index = 0;
+      }
+    #else
+      (void)field;
+    #endif
+    // clang-format on
+  }
+
+  // Fails verification once more than `max_bytes` bytes of vectors and
+  // strings in total were checked, counting them again each time they are
+  // reached. Limits the work done for hostile buffers.
+  void SetMaxBytes(size_t max_bytes) { max_bytes_ = max_bytes; }
+
+  // The bytes of vectors and strings checked so far.
+  size_t GetNumBytes() const { return bytes_; }
+
+  // The bytes of vectors and strings that may still be checked.
+  size_t GetBytesLeft() const {
+    return bytes_ < max_bytes_ ? max_bytes_ - bytes_ : 0;
+  }
+
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+  // Fails verification once `deadline` has passed, as checked every 64
+  // tables (and strings of vectors of strings). Limits the time spent on
+  // hostile buffers.
+  void SetDeadline(std::chrono::steady_clock::time_point deadline) {
+    deadline_ = deadline;
+    has_deadline_ = true;
+  }
+  #endif
+
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+  /// @brief Get the counters collected by this verifier.
+  /// @remark Only available if FLATBUFFERS_TRACK_VERIFIER_STATS is defined.
+  const VerifierStats &GetStats() const { return stats_; }
+  #endif
+  // clang-format on
+
+  // Verifies large vectors of tables with `parallelism` (may be NULL), see
+  // flatbuffers/parallel_verifier.h.
+  void SetParallelism(VerifierParallelism *parallelism) {
+    parallelism_ = parallelism;
+  }
+
+  // A verifier for a part of the buffer below the current table, e.g. to
+  // verify on another thread. It starts at the current depth, and may verify
+  // the tables and check the bytes left, which forks verifying at the same
+  // time must share (see ParallelVerification). Must be joined back into this
+  // one, or into JoinFailed().
+  Verifier Fork() const {
+    Verifier fork(buf_, size_, max_depth_, GetTablesLeft(), check_alignment_);
+    fork.depth_ = depth_;
+    fork.max_bytes_ = GetBytesLeft();
+    // clang-format off
+    #ifndef FLATBUFFERS_CPP98_STL
+      fork.deadline_ = deadline_;
+    #endif
+    // clang-format on
+    fork.has_deadline_ = has_deadline_;
+    FLATBUFFERS_VERIFIER_STAT(fork.path_ = path_);
+    return fork;
+  }
+
+  // Counts the tables verified by a fork, which must have verified its part
+  // successfully, as verified by this one. Fails if there are too many
+  // tables overall.
+  bool Join(const Verifier &fork) {
+    upper_bound_ = (std::max)(upper_bound_, fork.upper_bound_);
+    vtable_cache_hits_ += fork.vtable_cache_hits_;
+    vtable_cache_misses_ += fork.vtable_cache_misses_;
+    FLATBUFFERS_VERIFIER_STAT(stats_ += fork.stats_);
+    if (!Check(fork.num_tables_ <= GetTablesLeft())) return false;
+    num_tables_ += fork.num_tables_;
+    bytes_ += fork.bytes_;
+    return Check(bytes_ <= max_bytes_);
+  }
+
+  // Fails because a fork failed, where the fork did (see VerifierStats), or
+  // stopped because another did. Counts what it checked into the stats.
+  bool JoinFailed(const Verifier &fork) {
+    // clang-format off
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+      stats_ += fork.stats_;
+    #else
+      (void)fork;
+    #endif
+    // clang-format on
+    return Check(false);
+  }
+
   // Returns the message size in bytes
   size_t GetComputedSize() const {
     // clang-format off
@@ -2443,6 +4849,58 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   }
 
  private:
+  template<typename T>
+  static bool VerifyTables(Verifier &verifier, const void *vec,
+                           uoffset_t begin, uoffset_t end) {
+    auto tables = reinterpret_cast<const Vector<Offset<T>> *>(vec);
+    for (auto i = begin; i < end; i++) {
+      FLATBUFFERS_VERIFIER_STAT(verifier.SetPathIndex(i));
+      if (!verifier.VerifyTable(tables->Get(i))) return false;
+    }
+    return true;
+  }
+
+  bool WithinDeadline() const {
+    // clang-format off
+    #ifndef FLATBUFFERS_CPP98_STL
+      return !has_deadline_ ||
+             Check(std::chrono::steady_clock::now() <= deadline_);
+    #else
+      return true;
+    #endif
+    // clang-format on
+  }
+
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+  void SetPathIndex(uoffset_t i) const {
+    if (depth_ && depth_ <= path_.size()) path_[depth_ - 1].index = i;
+  }
+
+  void CountBuffer(std::chrono::steady_clock::time_point began) {
+    stats_.buffers++;
+    stats_.verify_ns += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - began)
+            .count());
+  }
+  #endif
+  // clang-format on
+
+  // An address unique to each type T.
+  template<typename T> static const void *VisitedTag() {
+    static const char tag = 0;
+    return &tag;
+  }
+
+  std::vector<uint64_t> &VisitedBits(const void *tag, size_t words) const {
+    for (auto it = visited_.begin(); it != visited_.end(); ++it) {
+      if (it->first == tag) return it->second;
+    }
+    visited_.push_back(std::make_pair(tag, std::vector<uint64_t>(words)));
+    return visited_.back().second;
+  }
+
   const uint8_t *buf_;
   size_t size_;
   uoffset_t depth_;
@@ -2451,6 +4909,34 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   uoffset_t max_tables_;
   mutable size_t upper_bound_;
   bool check_alignment_;
+  bool track_visited_;
+  // The offsets of recently checked vtables, by offset.
+  static const size_t kVTableCacheSize = 16;
+  size_t vtable_cache_[kVTableCacheSize];
+  size_t vtable_cache_hits_;
+  size_t vtable_cache_misses_;
+  VerifierParallelism *parallelism_;
+  // The objects reached so far, as a bitmap per type.
+  mutable std::vector<std::pair<const void *, std::vector<uint64_t>>>
+      visited_;
+  mutable size_t bytes_;
+  size_t max_bytes_;
+  // Tables and strings verified between looks at the clock.
+  static const uoffset_t kDeadlineInterval = 64;
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+    std::chrono::steady_clock::time_point deadline_;
+  #endif
+  // clang-format on
+  bool has_deadline_;
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+    // The offset last checked, and the field being verified at each depth.
+    mutable size_t offset_;
+    mutable std::vector<VerifierPathStep> path_;
+    mutable VerifierStats stats_;
+  #endif
+  // clang-format on
 };
 
 // Convenient way to bundle a buffer and its length, to pass it around
@@ -2515,61 +5001,96 @@ class Table {
 
   // This gets the field offset for any of the functions below it, or 0
   // if the field was not present.
+  // Under FLATBUFFERS_CHECKED_ACCESS, fields that fail the checks (see
+  // AccessOk()) are also reported as not present.
   voffset_t GetOptionalFieldOffset(voffset_t field) const {
     // The vtable offset is always at the start.
+    if (!AccessOk(data_, sizeof(soffset_t), sizeof(soffset_t))) return 0;
     auto vtable = GetVTable();
     // The first element is the size of the vtable (fields + type id + itself).
+    if (!AccessOk(vtable, sizeof(voffset_t), sizeof(voffset_t))) return 0;
     auto vtsize = ReadScalar<voffset_t>(vtable);
     // If the field we're accessing is outside the vtable, we're reading older
     // data, so it's the same as if the offset was 0 (not present).
-    return field < vtsize ? ReadScalar<voffset_t>(vtable + field) : 0;
+    if (field >= vtsize) return 0;
+    if (!AccessOk(vtable + field, sizeof(voffset_t), sizeof(voffset_t)))
+      return 0;
+    return ReadScalar<voffset_t>(vtable + field);
   }
 
   template<typename T> T GetField(voffset_t field, T defaultval) const {
     auto field_offset = GetOptionalFieldOffset(field);
-    return field_offset ? ReadScalar<T>(data_ + field_offset) : defaultval;
+    return field_offset && AccessOk(data_ + field_offset, sizeof(T), sizeof(T))
+               ? ReadScalar<T>(data_ + field_offset)
+               : defaultval;
   }
 
   template<typename P> P GetPointer(voffset_t field) {
     auto field_offset = GetOptionalFieldOffset(field);
     auto p = data_ + field_offset;
-    return field_offset ? reinterpret_cast<P>(p + ReadScalar<uoffset_t>(p))
-                        : nullptr;
+    if (!field_offset || !AccessOk(p, sizeof(uoffset_t), sizeof(uoffset_t)))
+      return nullptr;
+    p += ReadScalar<uoffset_t>(p);
+    return PointeeAccessCheck<P>::type::Ok(p) ? reinterpret_cast<P>(p)
+                                              : nullptr;
   }
   template<typename P> P GetPointer(voffset_t field) const {
     return const_cast<Table *>(this)->GetPointer<P>(field);
   }
 
+  // For fields with the `offset64` attribute.
+  template<typename P> P GetPointer64(voffset_t field) {
+    auto field_offset = GetOptionalFieldOffset(field);
+    auto p = data_ + field_offset;
+    if (!field_offset ||
+        !AccessOk(p, sizeof(uoffset64_t), sizeof(uoffset64_t)))
+      return nullptr;
+    p += ReadScalar<uoffset64_t>(p);
+    return PointeeAccessCheck<P>::type::Ok(p) ? reinterpret_cast<P>(p)
+                                              : nullptr;
+  }
+  template<typename P> P GetPointer64(voffset_t field) const {
+    return const_cast<Table *>(this)->GetPointer64<P>(field);
+  }
+
   template<typename P> P GetStruct(voffset_t field) const {
     auto field_offset = GetOptionalFieldOffset(field);
     auto p = const_cast<uint8_t *>(data_ + field_offset);
-    return field_offset ? reinterpret_cast<P>(p) : nullptr;
+    return field_offset && StructAccessCheck<P>::Ok(p)
+               ? reinterpret_cast<P>(p)
+               : nullptr;
   }
 
   template<typename Raw, typename Face>
   flatbuffers::Optional<Face> GetOptional(voffset_t field) const {
     auto field_offset = GetOptionalFieldOffset(field);
     auto p = data_ + field_offset;
-    return field_offset ? Optional<Face>(static_cast<Face>(ReadScalar<Raw>(p)))
-                        : Optional<Face>();
+    return field_offset && AccessOk(p, sizeof(Raw), sizeof(Raw))
+               ? Optional<Face>(static_cast<Face>(ReadScalar<Raw>(p)))
+               : Optional<Face>();
   }
 
   template<typename T> bool SetField(voffset_t field, T val, T def) {
     auto field_offset = GetOptionalFieldOffset(field);
     if (!field_offset) return IsTheSameAs(val, def);
+    if (!AccessOk(data_ + field_offset, sizeof(T), sizeof(T))) return false;
     WriteScalar(data_ + field_offset, val);
     return true;
   }
   template<typename T> bool SetField(voffset_t field, T val) {
     auto field_offset = GetOptionalFieldOffset(field);
-    if (!field_offset) return false;
+    if (!field_offset ||
+        !AccessOk(data_ + field_offset, sizeof(T), sizeof(T)))
+      return false;
     WriteScalar(data_ + field_offset, val);
     return true;
   }
 
   bool SetPointer(voffset_t field, const uint8_t *val) {
     auto field_offset = GetOptionalFieldOffset(field);
-    if (!field_offset) return false;
+    if (!field_offset ||
+        !AccessOk(data_ + field_offset, sizeof(uoffset_t), sizeof(uoffset_t)))
+      return false;
     WriteScalar(data_ + field_offset,
                 static_cast<uoffset_t>(val - (data_ + field_offset)));
     return true;
@@ -2596,6 +5117,7 @@ class Table {
   // Verify a particular field.
   template<typename T>
   bool VerifyField(const Verifier &verifier, voffset_t field) const {
+    verifier.VerifyingField(field);
     // Calling GetOptionalFieldOffset should be safe now thanks to
     // VerifyTable().
     auto field_offset = GetOptionalFieldOffset(field);
@@ -2606,6 +5128,7 @@ class Table {
   // VerifyField for required fields.
   template<typename T>
   bool VerifyFieldRequired(const Verifier &verifier, voffset_t field) const {
+    verifier.VerifyingField(field);
     auto field_offset = GetOptionalFieldOffset(field);
     return verifier.Check(field_offset != 0) &&
            verifier.Verify<T>(data_, field_offset);
@@ -2613,16 +5136,32 @@ class Table {
 
   // Versions for offsets.
   bool VerifyOffset(const Verifier &verifier, voffset_t field) const {
+    verifier.VerifyingField(field);
     auto field_offset = GetOptionalFieldOffset(field);
     return !field_offset || verifier.VerifyOffset(data_, field_offset);
   }
 
   bool VerifyOffsetRequired(const Verifier &verifier, voffset_t field) const {
+    verifier.VerifyingField(field);
     auto field_offset = GetOptionalFieldOffset(field);
     return verifier.Check(field_offset != 0) &&
            verifier.VerifyOffset(data_, field_offset);
   }
 
+  bool VerifyOffset64(const Verifier &verifier, voffset_t field) const {
+    verifier.VerifyingField(field);
+    auto field_offset = GetOptionalFieldOffset(field);
+    return !field_offset || verifier.VerifyOffset64(data_, field_offset);
+  }
+
+  bool VerifyOffset64Required(const Verifier &verifier,
+                              voffset_t field) const {
+    verifier.VerifyingField(field);
+    auto field_offset = GetOptionalFieldOffset(field);
+    return verifier.Check(field_offset != 0) &&
+           verifier.VerifyOffset64(data_, field_offset);
+  }
+
  private:
   // private constructor & copy constructor: you obtain instances of this
   // class by pointing to existing data only
@@ -2640,14 +5179,64 @@ inline flatbuffers::Optional<bool> Table::GetOptional<uint8_t, bool>(
     voffset_t field) const {
   auto field_offset = GetOptionalFieldOffset(field);
   auto p = data_ + field_offset;
-  return field_offset ? Optional<bool>(ReadScalar<uint8_t>(p) != 0)
-                      : Optional<bool>();
+  return field_offset && AccessOk(p, 1, 1)
+             ? Optional<bool>(ReadScalar<uint8_t>(p) != 0)
+             : Optional<bool>();
 }
 
+#ifdef FLATBUFFERS_CHECKED_ACCESS
+/// @brief Checks what the accessors of generated code read of a buffer on
+/// this thread lies within it, while in scope. This allows reading a few
+/// fields of a large untrusted buffer without verifying all of it first:
+///
+///   flatbuffers::CheckedAccess access(buf, len);
+///   auto monster = access.GetRoot<Monster>();
+///   auto name = monster ? monster->name() : nullptr;
+///   if (!access.ok()) { /* The buffer is corrupt. */ }
+///
+/// Fields that can't be read safely read as if absent: scalars as their
+/// default, and tables, strings and vectors as nullptr, even when required.
+/// Strings that are union values (read as tables) are not checked.
+class CheckedAccess {
+ public:
+  CheckedAccess(const void *buf, size_t len) : prev_(CurrentCheckedAccess()) {
+    FLATBUFFERS_ASSERT(buf);
+    auto &state = CurrentCheckedAccess();
+    state.begin = reinterpret_cast<const uint8_t *>(buf);
+    state.size = len;
+    state.failed = false;
+  }
+
+  ~CheckedAccess() { CurrentCheckedAccess() = prev_; }
+
+  // Whether all checks passed so far.
+  bool ok() const { return !CurrentCheckedAccess().failed; }
+
+  // Like flatbuffers::GetRoot(), or nullptr if the root can't be read.
+  template<typename T> const T *GetRoot() const {
+    auto buf = CurrentCheckedAccess().begin;
+    if (!AccessOk(buf, sizeof(uoffset_t), sizeof(uoffset_t))) return nullptr;
+    auto root = buf + ReadScalar<uoffset_t>(buf);
+    return AccessCheck<T>::Ok(root) ? reinterpret_cast<const T *>(root)
+                                    : nullptr;
+  }
+
+ private:
+  CheckedAccess(const CheckedAccess &);
+  CheckedAccess &operator=(const CheckedAccess &);
+
+  CheckedAccessState prev_;
+};
+#endif  // FLATBUFFERS_CHECKED_ACCESS
+
 template<typename T>
 void FlatBufferBuilder::Required(Offset<T> table, voffset_t field) {
-  auto table_ptr = reinterpret_cast<const Table *>(buf_.data_at(table.o));
-  bool ok = table_ptr->GetOptionalFieldOffset(field) != 0;
+  // Look the vtable up by offset rather than through Table::GetVTable(), as
+  // it may live in another block of a segmented buffer.
+  auto vtable = buf_.data_at(
+      table.o + ReadScalar<soffset_t>(buf_.data_at(table.o)));
+  bool ok = field < ReadScalar<voffset_t>(vtable) &&
+            ReadScalar<voffset_t>(vtable + field) != 0;
   // If this fails, the caller will show what field needs to be set.
   FLATBUFFERS_ASSERT(ok);
   (void)ok;
@@ -20,6 +20,7 @@
 #include <map>
 // Used to select STL variant.
 #include "flatbuffers/base.h"
+#include "flatbuffers/key_sort.h"
 // We use the basic binary writing functions from the regular FlatBuffers.
 #include "flatbuffers/util.h"
 
@@ -1120,28 +1121,23 @@ class Builder FLATBUFFERS_FINAL_CLASS {
     // be quite cheap (cheaper than checking it here), so we can skip this
     // step automatically when appliccable, and encourage people to write in
     // sorted fashion.
-    // std::sort is typically already a lot faster on sorted data though.
     auto dict =
         reinterpret_cast<TwoValue *>(flatbuffers::vector_data(stack_) + start);
-    std::sort(dict, dict + len,
-              [&](const TwoValue &a, const TwoValue &b) -> bool {
-                auto as = reinterpret_cast<const char *>(
-                    flatbuffers::vector_data(buf_) + a.key.u_);
-                auto bs = reinterpret_cast<const char *>(
-                    flatbuffers::vector_data(buf_) + b.key.u_);
-                auto comp = strcmp(as, bs);
-                // We want to disallow duplicate keys, since this results in a
-                // map where values cannot be found.
-                // But we can't assert here (since we don't want to fail on
-                // random JSON input) or have an error mechanism.
-                // Instead, we set has_duplicate_keys_ in the builder to
-                // signal this.
-                // TODO: Have to check for pointer equality, as some sort
-                // implementation apparently call this function with the same
-                // element?? Why?
-                if (!comp && &a != &b) has_duplicate_keys_ = true;
-                return comp < 0;
-              });
+    // The keys are extracted once, rather than read from buf_ (and measured)
+    // on every comparison.
+    auto duplicates = flatbuffers::SortByKey(
+        dict, len, [&](const TwoValue &e) -> flatbuffers::KeyString {
+          auto key = reinterpret_cast<const char *>(
+              flatbuffers::vector_data(buf_) + e.key.u_);
+          return flatbuffers::KeyString(key, strlen(key));
+        });
+    // We want to disallow duplicate keys, since this results in a
+    // map where values cannot be found.
+    // But we can't assert here (since we don't want to fail on
+    // random JSON input) or have an error mechanism.
+    // Instead, we set has_duplicate_keys_ in the builder to
+    // signal this.
+    if (duplicates) has_duplicate_keys_ = true;
     // First create a vector out of all keys.
     // TODO(wvo): if kBuilderFlagShareKeyVectors is true, see if we can share
     // the first vector.
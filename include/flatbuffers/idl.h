@@ -288,6 +288,10 @@ struct Definition {
   int refcount;
 };
 
+// Suffix of the auto-generated field holding the index of a vector with the
+// `hash_index` attribute.
+inline const char *HashIndexFieldSuffix() { return "_hash_index"; }
+
 struct FieldDef : public Definition {
   FieldDef()
       : deprecated(false),
@@ -295,6 +299,7 @@ struct FieldDef : public Definition {
         shared(false),
         native_inline(false),
         flexbuffer(false),
+        offset64(false),
         presence(kDefault),
         nested_flatbuffer(NULL),
         padding(0) {}
@@ -326,6 +331,7 @@ struct FieldDef : public Definition {
   bool native_inline;  // Field will be defined inline (instead of as a pointer)
                        // for native tables if field is a struct.
   bool flexbuffer;     // This field contains FlexBuffer data.
+  bool offset64;       // Refers to its string/vector with a 64-bit offset.
 
   enum Presence {
     // Field must always be present.
@@ -811,6 +817,10 @@ class Parser : public ParserState {
     known_attributes_["native_type"] = true;
     known_attributes_["native_default"] = true;
     known_attributes_["flexbuffer"] = true;
+    known_attributes_["offset64"] = true;
+    known_attributes_["precomputed_vtable"] = true;
+    known_attributes_["eytzinger"] = true;
+    known_attributes_["hash_index"] = true;
     known_attributes_["private"] = true;
   }
 
@@ -977,6 +987,8 @@ class Parser : public ParserState {
   bool SupportsAdvancedArrayFeatures() const;
   bool SupportsOptionalScalars() const;
   bool SupportsDefaultVectorsAndStrings() const;
+  bool SupportsOffset64() const;
+  bool SupportsEytzinger() const;
   Namespace *UniqueNamespace(Namespace *ns);
 
   FLATBUFFERS_CHECKED_ERROR RecurseError();
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_KEY_SORT_H_
+#define FLATBUFFERS_KEY_SORT_H_
+
+#include "flatbuffers/base.h"
+
+namespace flatbuffers {
+
+/// @cond FLATBUFFERS_INTERNAL
+
+// Sorting of objects by key, as done by FlatBufferBuilder for vectors of
+// tables or structs with a key, and by flexbuffers::Builder for maps.
+// All keys are first extracted into a contiguous array, so comparisons don't
+// have to go through the objects (and their vtables) in the buffer. Scalar
+// keys are radix sorted, string keys compare an 8 byte prefix first.
+
+// A string key, compared bytewise like `String::operator<`.
+struct KeyString {
+  KeyString(const char *_str, size_t _len) : str(_str), len(_len) {}
+  const char *str;
+  size_t len;
+};
+
+// Maps scalar keys to unsigned integers of the same size and order.
+template<typename T> struct RadixKey {
+  typedef T type;  // Unsigned integers map to themselves.
+  static type Get(T key) { return key; }
+};
+
+template<typename T, typename U> struct SignedRadixKey {
+  typedef U type;
+  static type Get(T key) {
+    return static_cast<U>(static_cast<U>(key) ^
+                          (static_cast<U>(1) << (sizeof(U) * 8 - 1)));
+  }
+};
+
+template<typename T, typename U> struct FloatRadixKey {
+  typedef U type;
+  static type Get(T key) {
+    U bits;
+    memcpy(&bits, &key, sizeof(U));
+    const auto sign = static_cast<U>(1) << (sizeof(U) * 8 - 1);
+    return bits & sign ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+  }
+};
+
+template<> struct RadixKey<int8_t> : SignedRadixKey<int8_t, uint8_t> {};
+template<> struct RadixKey<int16_t> : SignedRadixKey<int16_t, uint16_t> {};
+template<> struct RadixKey<int32_t> : SignedRadixKey<int32_t, uint32_t> {};
+template<> struct RadixKey<int64_t> : SignedRadixKey<int64_t, uint64_t> {};
+template<> struct RadixKey<float> : FloatRadixKey<float, uint32_t> {};
+template<> struct RadixKey<double> : FloatRadixKey<double, uint64_t> {};
+
+// Below this many elements, a comparison sort is faster than a radix sort.
+static const size_t kMinRadixSortSize = 64;
+
+// Sorts (key, index) pairs by key, keeping equal keys in order.
+template<typename U> void RadixSort(std::vector<std::pair<U, size_t>> *v) {
+  if (v->size() < kMinRadixSortSize) {
+    std::stable_sort(v->begin(), v->end(),
+                     [](const std::pair<U, size_t> &a,
+                        const std::pair<U, size_t> &b) {
+                       return a.first < b.first;
+                     });
+    return;
+  }
+  std::vector<std::pair<U, size_t>> tmp(v->size());
+  for (size_t shift = 0; shift < sizeof(U) * 8; shift += 8) {
+    size_t starts[257] = { 0 };
+    for (auto it = v->begin(); it != v->end(); ++it) {
+      starts[((it->first >> shift) & 0xFF) + 1]++;
+    }
+    // All keys have the same byte here, so this pass would not move any.
+    if (starts[((v->front().first >> shift) & 0xFF) + 1] == v->size()) {
+      continue;
+    }
+    for (size_t i = 1; i < 257; i++) starts[i] += starts[i - 1];
+    for (auto it = v->begin(); it != v->end(); ++it) {
+      tmp[starts[(it->first >> shift) & 0xFF]++] = *it;
+    }
+    v->swap(tmp);
+  }
+}
+
+// The first 8 bytes of a string key as an integer of the same order.
+inline uint64_t KeyPrefix(const KeyString &key) {
+  uint64_t prefix = 0;
+  for (size_t i = 0; i < sizeof(uint64_t); i++) {
+    prefix <<= 8;
+    if (i < key.len) prefix |= static_cast<uint8_t>(key.str[i]);
+  }
+  return prefix;
+}
+
+struct StringSortKey {
+  uint64_t prefix;
+  KeyString key;
+  size_t index;
+};
+
+inline int CompareKeys(const StringSortKey &a, const StringSortKey &b) {
+  if (a.prefix != b.prefix) return a.prefix < b.prefix ? -1 : 1;
+  auto cmp = memcmp(a.key.str, b.key.str, (std::min)(a.key.len, b.key.len));
+  if (cmp) return cmp;
+  return static_cast<int>(a.key.len > b.key.len) -
+         static_cast<int>(a.key.len < b.key.len);
+}
+
+// Finds the order of `len` elements by their scalar keys. `key_of(i)` returns
+// the key of element `i`. Returns whether any keys are equal.
+template<typename K> struct KeySorter {
+  template<typename KeyOf>
+  static bool Sort(size_t len, KeyOf key_of, std::vector<size_t> *order) {
+    typedef typename RadixKey<K>::type U;
+    std::vector<std::pair<U, size_t>> keys(len);
+    for (size_t i = 0; i < len; i++) {
+      keys[i] = std::make_pair(RadixKey<K>::Get(key_of(i)), i);
+    }
+    RadixSort(&keys);
+    bool duplicates = false;
+    for (size_t i = 0; i < len; i++) {
+      (*order)[i] = keys[i].second;
+      if (i && keys[i].first == keys[i - 1].first) duplicates = true;
+    }
+    return duplicates;
+  }
+};
+
+template<> struct KeySorter<KeyString> {
+  template<typename KeyOf>
+  static bool Sort(size_t len, KeyOf key_of, std::vector<size_t> *order) {
+    std::vector<StringSortKey> keys;
+    keys.reserve(len);
+    for (size_t i = 0; i < len; i++) {
+      StringSortKey k = { 0, key_of(i), i };
+      k.prefix = KeyPrefix(k.key);
+      keys.push_back(k);
+    }
+    std::sort(keys.begin(), keys.end(),
+              [](const StringSortKey &a, const StringSortKey &b) {
+                return CompareKeys(a, b) < 0;
+              });
+    bool duplicates = false;
+    for (size_t i = 0; i < len; i++) {
+      (*order)[i] = keys[i].index;
+      if (i && !CompareKeys(keys[i], keys[i - 1])) duplicates = true;
+    }
+    return duplicates;
+  }
+};
+
+// Sorts the `len` elements of `v` by `key_of(v[i])`, which returns either a
+// scalar or a KeyString. Returns whether any keys are equal.
+template<typename E, typename KeyOf>
+bool SortByKey(E *v, size_t len, KeyOf key_of) {
+  typedef decltype(key_of(*v)) K;
+  std::vector<size_t> order(len);
+  auto duplicates = KeySorter<K>::Sort(
+      len, [&](size_t i) { return key_of(v[i]); }, &order);
+  std::vector<E> sorted;
+  sorted.reserve(len);
+  for (size_t i = 0; i < len; i++) sorted.push_back(v[order[i]]);
+  std::copy(sorted.begin(), sorted.end(), v);
+  return duplicates;
+}
+
+// The Eytzinger layout of a sorted sequence, used by vectors with the
+// `eytzinger` attribute, stores it as an implicit binary search tree in
+// breadth first order. Nodes are numbered from 1, so the children of node k
+// are 2k and 2k+1, and node k is stored at index k-1. Searches touch the
+// top levels of the tree most, which are all next to each other at the front.
+
+// The node with the smallest key in a tree of `size` nodes, or 0 if empty.
+inline uoffset_t EytzingerFirst(uoffset_t size) {
+  if (!size) return 0;
+  uoffset_t k = 1;
+  while (k <= size / 2) k *= 2;
+  return k;
+}
+
+// The node with the next larger key after node `k`, or 0 if it was the last.
+inline uoffset_t EytzingerNext(uoffset_t k, uoffset_t size) {
+  if (k <= (size - 1) / 2) {
+    // The leftmost node of the right subtree.
+    k = 2 * k + 1;
+    while (k <= size / 2) k *= 2;
+    return k;
+  }
+  // Go up past all nodes this was the right child of, then one more.
+  while (k & 1) k >>= 1;
+  return k >> 1;
+}
+
+// Stores the `len` sorted elements of `sorted` into `out` in Eytzinger order.
+template<typename E>
+void ToEytzingerOrder(const E *sorted, size_t len, E *out) {
+  const auto size = static_cast<uoffset_t>(len);
+  size_t i = 0;
+  for (auto k = EytzingerFirst(size); k; k = EytzingerNext(k, size)) {
+    out[k - 1] = sorted[i++];
+  }
+}
+
+/// @endcond
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_KEY_SORT_H_
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_MMAP_BUILDER_H_
+#define FLATBUFFERS_MMAP_BUILDER_H_
+
+// Building FlatBuffers directly into a memory-mapped file (POSIX only).
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "flatbuffers/flatbuffers.h"
+
+#if defined(__linux__)
+#  include <linux/falloc.h>
+#endif
+
+namespace flatbuffers {
+
+// MmapFileAllocator backs a single `vector_downward` with a shared mapping of
+// a sparse file. The whole address range of up to `max_size` bytes is mapped
+// once, and allocations are handed out from its end, so growing downwards
+// never copies the data at the back: pages are only backed by the file (and
+// may be evicted to it) once written.
+// Only one allocation can be live at a time, so it can't back a segmented
+// buffer (see `FlatBufferBuilder::SegmentedBuffer()`). Further allocations
+// come from the heap instead, and make Commit() fail.
+class MmapFileAllocator : public Allocator {
+ public:
+  MmapFileAllocator(const char *path, size_t max_size)
+      : fd_(-1),
+        map_(nullptr),
+        region_(nullptr),
+        max_size_(max_size),
+        live_(false),
+        failed_(false) {
+    fd_ = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) return;
+    auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    max_size_ = (max_size_ + page - 1) & ~(page - 1);
+    void *map = MAP_FAILED;
+    if (ftruncate(fd_, static_cast<off_t>(max_size_)) == 0) {
+      map = mmap(nullptr, max_size_, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_NORESERVE, fd_, 0);
+    }
+    if (map == MAP_FAILED) {
+      close(fd_);
+      fd_ = -1;
+      return;
+    }
+    map_ = static_cast<uint8_t *>(map);
+    region_ = map_;
+  }
+
+  ~MmapFileAllocator() { Close(); }
+
+  // Whether the file could be created and mapped.
+  bool ok() const { return map_ != nullptr; }
+
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    FLATBUFFERS_ASSERT(ok() && size <= max_size_);
+    // If this hits, the builder needs more than one buffer at a time.
+    FLATBUFFERS_ASSERT(!live_);
+    if (live_) {
+      failed_ = true;
+      return new uint8_t[size];
+    }
+    live_ = true;
+    return map_ + max_size_ - size;
+  }
+
+  // The mapping is released by Commit() or the destructor.
+  void deallocate(uint8_t *p, size_t) FLATBUFFERS_OVERRIDE {
+    if (InMap(p)) {
+      live_ = false;
+    } else {
+      delete[] p;
+    }
+  }
+
+  uint8_t *reallocate_downward(uint8_t *old_p, size_t old_size,
+                               size_t new_size, size_t in_use_back,
+                               size_t in_use_front) FLATBUFFERS_OVERRIDE {
+    if (!InMap(old_p)) {
+      return Allocator::reallocate_downward(old_p, old_size, new_size,
+                                            in_use_back, in_use_front);
+    }
+    FLATBUFFERS_ASSERT(new_size > old_size);  // vector_downward only grows
+    // If this hits, pass a larger `max_size`.
+    FLATBUFFERS_ASSERT(new_size <= max_size_);
+    (void)old_size;
+    (void)in_use_back;
+    // The back stays in place, only the scratch area at the front moves.
+    auto new_p = map_ + max_size_ - new_size;
+    memmove(new_p, old_p, in_use_front);
+    return new_p;
+  }
+
+  // Turns the file into exactly the `size` bytes at the end of the mapping,
+  // and releases the mapping. Where supported (Linux, on ext4 or XFS), the
+  // unused front of the file is dropped without moving any data, as long as
+  // its size is a multiple of the filesystem block size. Otherwise the data
+  // is moved to the start of the file first.
+  bool Commit(size_t size) {
+    if (!ok() || failed_) return false;
+    auto unused = max_size_ - size;
+    bool collapsed = unused == 0;
+    // clang-format off
+    #if defined(FALLOC_FL_COLLAPSE_RANGE)
+      if (!collapsed) {
+        collapsed = fallocate(fd_, FALLOC_FL_COLLAPSE_RANGE, 0,
+                              static_cast<off_t>(unused)) == 0;
+      }
+    #endif
+    // clang-format on
+    if (!collapsed) memmove(map_, map_ + unused, size);
+    munmap(map_, max_size_);
+    map_ = nullptr;
+    bool truncated = ftruncate(fd_, static_cast<off_t>(size)) == 0;
+    Close();
+    return truncated;
+  }
+
+ private:
+  // Whether `p` was allocated from the mapping, even if it was released.
+  bool InMap(const uint8_t *p) const {
+    return region_ && p >= region_ && p < region_ + max_size_;
+  }
+
+  void Close() {
+    if (map_) munmap(map_, max_size_);
+    if (fd_ >= 0) close(fd_);
+    map_ = nullptr;
+    fd_ = -1;
+  }
+
+  int fd_;
+  uint8_t *map_;
+  const uint8_t *region_;  // Where the mapping was, after Commit().
+  size_t max_size_;
+  bool live_;    // Whether the end of the mapping is allocated.
+  bool failed_;  // Whether anything was allocated from the heap instead.
+
+  // You shouldn't be copying instances of this class.
+  FLATBUFFERS_DELETE_FUNC(MmapFileAllocator(const MmapFileAllocator &));
+  FLATBUFFERS_DELETE_FUNC(
+      MmapFileAllocator &operator=(const MmapFileAllocator &));
+};
+
+// MmapFileAllocatorMember ensures the allocator is constructed before the
+// FlatBufferBuilder that uses it, like grpc::detail::SliceAllocatorMember.
+namespace detail {
+struct MmapFileAllocatorMember {
+  MmapFileAllocatorMember(const char *path, size_t max_size)
+      : mmap_allocator_(path, max_size) {}
+  MmapFileAllocator mmap_allocator_;
+};
+}  // namespace detail
+
+// MmapFileBuilder is a FlatBufferBuilder that serializes a single buffer
+// straight into the file at `path`, which never needs more memory than the
+// pages being written. Build and Finish() as usual, then call Commit() to
+// leave the finished buffer as the file's contents.
+// The buffer is padded to a multiple of the page size, so the unused front
+// of the file can be dropped by Commit() without moving any data.
+class MmapFileBuilder : private detail::MmapFileAllocatorMember,
+                        public FlatBufferBuilder {
+ public:
+  // `max_size` reserves address space (not memory or disk) for the largest
+  // buffer this builder may grow to.
+  explicit MmapFileBuilder(const char *path,
+                           size_t max_size = FLATBUFFERS_MAX_BUFFER_SIZE,
+                           size_t initial_size = 1 << 16)
+      : detail::MmapFileAllocatorMember(path, max_size),
+        FlatBufferBuilder(initial_size, &mmap_allocator_, false) {
+    AlignToPages();
+  }
+
+  // Whether the file could be created and mapped. Nothing else in this class
+  // may be used if not.
+  bool ok() const { return mmap_allocator_.ok(); }
+
+  // Like those of FlatBufferBuilder, but keep the buffer padded to pages.
+  void Clear() {
+    FlatBufferBuilder::Clear();
+    AlignToPages();
+  }
+
+  void Reset() {
+    FlatBufferBuilder::Reset();
+    AlignToPages();
+  }
+
+  // Completes the file after Finish() has been called, and returns whether
+  // that succeeded. Afterwards the builder can no longer be used.
+  bool Commit() {
+    Finished();
+    return mmap_allocator_.Commit(GetSize64());
+  }
+
+ private:
+  void AlignToPages() {
+    TrackMinAlign(static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+  }
+
+  // The file holds a single memory block, see MmapFileAllocator.
+  using FlatBufferBuilder::SegmentedBuffer;
+
+  // You shouldn't be copying or moving instances of this class.
+  FLATBUFFERS_DELETE_FUNC(MmapFileBuilder(const MmapFileBuilder &));
+  FLATBUFFERS_DELETE_FUNC(MmapFileBuilder &operator=(const MmapFileBuilder &));
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_MMAP_BUILDER_H_
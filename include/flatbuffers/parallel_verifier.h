@@ -0,0 +1,145 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_PARALLEL_VERIFIER_H_
+#define FLATBUFFERS_PARALLEL_VERIFIER_H_
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace flatbuffers {
+
+// Verifies the tables of large vectors of tables on several threads, with
+// the same result as verifying them on one:
+//
+//   flatbuffers::Verifier verifier(buf, len);
+//   flatbuffers::ParallelVerification parallel(8);
+//   verifier.SetParallelism(&parallel);
+//   bool ok = VerifyMonsterBuffer(verifier);
+//
+// Each vector of at least `min_size` tables is split into parts, which are
+// verified by forks of the verifier (see Verifier::Fork()) at the same depth.
+// The forks share the verifier's table and byte budgets, so all stop soon
+// after one is exhausted, or after any of them fails. Vectors inside the
+// parts are verified sequentially. Verifiers tracking visited tables don't use this.
+class ParallelVerification : public VerifierParallelism {
+ public:
+  // Runs `task(i)` for each i in [0, count), and returns when all are done,
+  // e.g. on a thread pool.
+  typedef std::function<void(size_t count,
+                             const std::function<void(size_t)> &task)>
+      Executor;
+
+  // Splits vectors into `parts` parts, each verified on its own std::thread
+  // (one of them the calling thread).
+  explicit ParallelVerification(
+      size_t parts = std::thread::hardware_concurrency(),
+      uoffset_t min_size = 4096)
+      : executor_(RunOnThreads),
+        parts_((std::max)(parts, static_cast<size_t>(1))),
+        min_size_(min_size) {}
+
+  // Splits vectors into `parts` parts, run by `executor`.
+  ParallelVerification(const Executor &executor, size_t parts,
+                       uoffset_t min_size = 4096)
+      : executor_(executor),
+        parts_((std::max)(parts, static_cast<size_t>(1))),
+        min_size_(min_size) {}
+
+  uoffset_t MinSize() const FLATBUFFERS_OVERRIDE { return min_size_; }
+
+  bool VerifyElements(Verifier &verifier, const void *vec, uoffset_t size,
+                      ElementVerifier verify) FLATBUFFERS_OVERRIDE {
+    const auto parts = (std::min)(parts_, static_cast<size_t>(size));
+    if (parts <= 1) return verify(verifier, vec, 0, size);
+    std::vector<Verifier> forks(parts, verifier.Fork());
+    const auto tables_left = verifier.GetTablesLeft();
+    const auto bytes_left = verifier.GetBytesLeft();
+    std::atomic<size_t> tables(0);
+    std::atomic<size_t> bytes(0);
+    std::atomic<bool> failed(false);
+    // The parts that failed themselves, rather than stopped for another.
+    std::vector<char> part_failed(parts, 0);
+    executor_(parts, [&](size_t part) {
+      auto &fork = forks[part];
+      auto i = static_cast<uoffset_t>(size * part / parts);
+      const auto end = static_cast<uoffset_t>(size * (part + 1) / parts);
+      while (i < end) {
+        if (failed.load(std::memory_order_relaxed)) return;
+        // Count the tables and bytes of some elements at a time into the
+        // budgets. Within them, the fork may check the bytes still left.
+        const auto block_end = (std::min)(end, i + kBlockSize);
+        const auto before = fork.GetNumTables();
+        const auto bytes_before = fork.GetNumBytes();
+        const size_t used = bytes.load(std::memory_order_relaxed);
+        const size_t left = used < bytes_left ? bytes_left - used : 0;
+        fork.SetMaxBytes(bytes_before +
+                         (std::min)(left, ~size_t(0) - bytes_before));
+        if (!verify(fork, vec, i, block_end)) {
+          part_failed[part] = 1;
+          failed = true;
+          return;
+        }
+        i = block_end;
+        const size_t added = fork.GetNumTables() - before;
+        const size_t added_bytes = fork.GetNumBytes() - bytes_before;
+        if (tables.fetch_add(added) + added > tables_left ||
+            bytes.fetch_add(added_bytes) + added_bytes > bytes_left) {
+          failed = true;
+          return;
+        }
+      }
+    });
+    if (failed) {
+      // The first part that failed tells where, then the others count what
+      // they checked before stopping. If none failed, this is the same
+      // failure the sequential verifier had at the table or byte too many.
+      for (size_t part = 0; part < parts; part++) {
+        if (part_failed[part]) verifier.JoinFailed(forks[part]);
+      }
+      for (size_t part = 0; part < parts; part++) {
+        if (!part_failed[part]) verifier.JoinFailed(forks[part]);
+      }
+      return verifier.Check(false);
+    }
+    for (auto it = forks.begin(); it != forks.end(); ++it) {
+      if (!verifier.Join(*it)) return false;
+    }
+    return true;
+  }
+
+ private:
+  static const uoffset_t kBlockSize = 256;
+
+  static void RunOnThreads(size_t count,
+                           const std::function<void(size_t)> &task) {
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < count; i++) threads.push_back(std::thread(task, i));
+    task(0);
+    for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+  }
+
+  Executor executor_;
+  size_t parts_;
+  uoffset_t min_size_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_PARALLEL_VERIFIER_H_
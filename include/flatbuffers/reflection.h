@@ -127,7 +127,9 @@ T GetFieldF(const Table &table, const reflection::Field &field) {
 inline const String *GetFieldS(const Table &table,
                                const reflection::Field &field) {
   FLATBUFFERS_ASSERT(field.type()->base_type() == reflection::String);
-  return table.GetPointer<const String *>(field.offset());
+  return field.offset64()
+             ? table.GetPointer64<const String *>(field.offset())
+             : table.GetPointer<const String *>(field.offset());
 }
 
 // Get a field, if you know it's a vector.
@@ -135,7 +137,8 @@ template<typename T>
 Vector<T> *GetFieldV(const Table &table, const reflection::Field &field) {
   FLATBUFFERS_ASSERT(field.type()->base_type() == reflection::Vector &&
                      sizeof(T) == GetTypeSize(field.type()->element()));
-  return table.GetPointer<Vector<T> *>(field.offset());
+  return field.offset64() ? table.GetPointer64<Vector<T> *>(field.offset())
+                          : table.GetPointer<Vector<T> *>(field.offset());
 }
 
 // Get a field, if you know it's a vector, generically.
@@ -143,7 +146,8 @@ Vector<T> *GetFieldV(const Table &table, const reflection::Field &field) {
 // field.type()->element() in any of GetAnyVectorElemI below etc.
 inline VectorOfAny *GetFieldAnyV(const Table &table,
                                  const reflection::Field &field) {
-  return table.GetPointer<VectorOfAny *>(field.offset());
+  return field.offset64() ? table.GetPointer64<VectorOfAny *>(field.offset())
+                          : table.GetPointer<VectorOfAny *>(field.offset());
 }
 
 // Get a field, if you know it's a table.
@@ -482,6 +486,8 @@ inline bool SetFieldT(Table *table, const reflection::Field &field,
 // Note: this does not deal with DAGs correctly. If the table passed forms a
 // DAG, the copy will be a tree instead (with duplicates). Strings can be
 // shared however, by passing true for use_string_pooling.
+// Returns a null offset if the table, or any table it refers to, has fields
+// with 64-bit offsets (see `offset64`), as these can't be copied this way.
 
 Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
                                 const reflection::Schema &schema,
@@ -0,0 +1,637 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_VECTOR_KERNELS_H_
+#define FLATBUFFERS_VECTOR_KERNELS_H_
+
+// Aggregates (sum, min, max, count, filter) over columns of scalars read
+// straight from a buffer: the elements of a `Vector<T>`, or one field of each
+// struct in a `Vector<const S *>`.
+// Columns of `float` and `int32_t` use SSE2 or AVX2 on x86 (picked at
+// runtime), other types and platforms a scalar loop.
+
+#include <limits>
+
+#include "flatbuffers/flatbuffers.h"
+
+// clang-format off
+#if FLATBUFFERS_LITTLEENDIAN && \
+    (defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__))
+  #define FLATBUFFERS_VECTOR_KERNELS_SSE2 1
+  #include <emmintrin.h>
+  // Compiled for AVX2 per function, so only GCC and clang.
+  #if defined(__GNUC__) || defined(__clang__)
+    #define FLATBUFFERS_VECTOR_KERNELS_AVX2 1
+    #include <immintrin.h>
+    #define FLATBUFFERS_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+#endif
+// clang-format on
+
+namespace flatbuffers {
+
+// A column of scalars of type T in a buffer, `stride` bytes apart.
+template<typename T> class Column {
+ public:
+  Column(const uint8_t *data, size_t size, size_t stride)
+      : data_(data), size_(size), stride_(stride) {}
+
+  // The elements of `vec`, which may be null (the field is not set).
+  explicit Column(const Vector<T> *vec)
+      : data_(vec ? vec->Data() : nullptr),
+        size_(vec ? vec->size() : 0),
+        stride_(sizeof(T)) {}
+
+  size_t size() const { return size_; }
+  size_t stride() const { return stride_; }
+  const uint8_t *data() const { return data_; }
+  bool contiguous() const { return stride_ == sizeof(T); }
+
+  T operator[](size_t i) const { return ReadScalar<T>(data_ + i * stride_); }
+
+ private:
+  const uint8_t *data_;
+  size_t size_;
+  size_t stride_;
+};
+
+// The field at byte `offset` of each struct in `vec`, such as
+// `StructColumn<float>(monster->path(), Vec3::OFFSET_X)` with the offsets
+// generated for structs.
+template<typename T, typename S>
+Column<T> StructColumn(const Vector<const S *> *vec, size_t offset) {
+  FLATBUFFERS_ASSERT(offset + sizeof(T) <= sizeof(S));
+  return Column<T>(vec ? vec->Data() + offset : nullptr, VectorLength(vec),
+                   sizeof(S));
+}
+
+enum ColumnCompare {
+  kColumnLess,
+  kColumnLessEqual,
+  kColumnGreater,
+  kColumnGreaterEqual,
+  kColumnEqual,
+  kColumnNotEqual
+};
+
+// The instruction sets column kernels may use.
+enum ColumnIsa { kColumnScalar, kColumnSSE2, kColumnAVX2 };
+
+/// @cond FLATBUFFERS_INTERNAL
+namespace detail {
+
+inline ColumnIsa CpuColumnIsa() {
+  // clang-format off
+  #if defined(FLATBUFFERS_VECTOR_KERNELS_AVX2)
+    if (__builtin_cpu_supports("avx2")) return kColumnAVX2;
+  #endif
+  #if defined(FLATBUFFERS_VECTOR_KERNELS_SSE2)
+    return kColumnSSE2;
+  #else
+    return kColumnScalar;
+  #endif
+  // clang-format on
+}
+
+inline ColumnIsa DetectColumnIsa() {
+  static const ColumnIsa isa = CpuColumnIsa();
+  return isa;
+}
+
+inline ColumnIsa &MaxColumnIsa() {
+  static ColumnIsa isa = kColumnAVX2;
+  return isa;
+}
+
+// Sums are of 64-bit integers or doubles, so they don't overflow (or lose
+// precision) as easily as the elements would.
+template<typename T, bool = std::is_floating_point<T>::value,
+         bool = std::is_signed<T>::value>
+struct ColumnSumOf {
+  typedef uint64_t type;
+};
+template<typename T> struct ColumnSumOf<T, false, true> {
+  typedef int64_t type;
+};
+template<typename T, bool S> struct ColumnSumOf<T, true, S> {
+  typedef double type;
+};
+
+template<typename T> bool Compare(T a, T b, ColumnCompare op) {
+  switch (op) {
+    case kColumnLess: return a < b;
+    case kColumnLessEqual: return a <= b;
+    case kColumnGreater: return a > b;
+    case kColumnGreaterEqual: return a >= b;
+    case kColumnEqual: return a == b;
+    case kColumnNotEqual: return a != b;
+  }
+  return false;
+}
+
+inline size_t CountBits(uint32_t bits) {
+  size_t count = 0;
+  for (; bits; bits &= bits - 1) count++;
+  return count;
+}
+
+// The kernels for one instruction set, with `ATTRS` on all functions (the
+// AVX2 ones need to be compiled for AVX2 as a whole). `V` provides, for
+// vectors of `V::kLanes` elements: Load(), Set(), Min(), Max(), a mask of the
+// lanes that Compare() true, and sums widened to `V::Sum`.
+// clang-format off
+#define FLATBUFFERS_SIMD_KERNELS(NAME, ATTRS)                                 \
+  template<typename V> struct NAME {                                          \
+    typedef typename V::T T;                                                  \
+    typedef typename ColumnSumOf<T>::type S;                                  \
+    static const size_t kLanes = V::kLanes;                                   \
+                                                                              \
+    ATTRS static S Sum(const Column<T> &col) {                                \
+      typename V::Sum acc = V::ZeroSum();                                     \
+      size_t i = 0;                                                           \
+      for (; i + kLanes <= col.size(); i += kLanes) {                         \
+        acc = V::AddSum(acc, V::Load(col, i));                                \
+      }                                                                       \
+      S sum = V::ReduceSum(acc);                                              \
+      for (; i < col.size(); i++) sum += col[i];                              \
+      return sum;                                                             \
+    }                                                                         \
+                                                                              \
+    template<bool kMin> ATTRS static T MinMax(const Column<T> &col, T init) { \
+      T result = init;                                                        \
+      size_t i = 0;                                                           \
+      if (col.size() >= kLanes) {                                             \
+        auto acc = V::Load(col, 0);                                           \
+        for (i = kLanes; i + kLanes <= col.size(); i += kLanes) {             \
+          const auto v = V::Load(col, i);                                     \
+          acc = kMin ? V::Min(acc, v) : V::Max(acc, v);                       \
+        }                                                                     \
+        T lanes[kLanes];                                                      \
+        V::Store(lanes, acc);                                                 \
+        for (size_t l = 0; l < kLanes; l++) {                                 \
+          result = kMin ? (std::min)(result, lanes[l])                        \
+                        : (std::max)(result, lanes[l]);                       \
+        }                                                                     \
+      }                                                                       \
+      for (; i < col.size(); i++) {                                           \
+        const auto e = col[i];                                                \
+        result = kMin ? (std::min)(result, e) : (std::max)(result, e);        \
+      }                                                                       \
+      return result;                                                          \
+    }                                                                         \
+                                                                              \
+    ATTRS static size_t CountIf(const Column<T> &col, ColumnCompare op,       \
+                                T value) {                                    \
+      const auto v = V::Set(value);                                           \
+      size_t count = 0;                                                       \
+      size_t i = 0;                                                           \
+      for (; i + kLanes <= col.size(); i += kLanes) {                         \
+        count += CountBits(V::Compare(V::Load(col, i), v, op));               \
+      }                                                                       \
+      for (; i < col.size(); i++) count += Compare(col[i], value, op);        \
+      return count;                                                           \
+    }                                                                         \
+                                                                              \
+    ATTRS static void Filter(const Column<T> &col, ColumnCompare op, T value, \
+                             std::vector<uoffset_t> *indices) {               \
+      const auto v = V::Set(value);                                           \
+      size_t i = 0;                                                           \
+      for (; i + kLanes <= col.size(); i += kLanes) {                         \
+        const auto bits = V::Compare(V::Load(col, i), v, op);                 \
+        for (size_t lane = 0; lane < kLanes; lane++) {                        \
+          if (bits & (1u << lane)) {                                          \
+            indices->push_back(static_cast<uoffset_t>(i + lane));             \
+          }                                                                   \
+        }                                                                     \
+      }                                                                       \
+      for (; i < col.size(); i++) {                                           \
+        if (Compare(col[i], value, op)) {                                     \
+          indices->push_back(static_cast<uoffset_t>(i));                      \
+        }                                                                     \
+      }                                                                       \
+    }                                                                         \
+  };
+// clang-format on
+
+FLATBUFFERS_SIMD_KERNELS(SimdKernels, )
+
+// clang-format off
+#if defined(FLATBUFFERS_VECTOR_KERNELS_SSE2)
+// clang-format on
+struct Sse2Float {
+  typedef float T;
+  typedef __m128 Vec;
+  struct Sum {
+    __m128d lo, hi;
+  };
+  static const size_t kLanes = 4;
+  static Vec Load(const Column<T> &col, size_t i) {
+    if (col.contiguous()) {
+      return _mm_loadu_ps(reinterpret_cast<const float *>(col.data()) + i);
+    }
+    return _mm_setr_ps(col[i], col[i + 1], col[i + 2], col[i + 3]);
+  }
+  static Vec Set(T value) { return _mm_set1_ps(value); }
+  static void Store(T *lanes, Vec v) { _mm_storeu_ps(lanes, v); }
+  static Vec Min(Vec a, Vec b) { return _mm_min_ps(a, b); }
+  static Vec Max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+  static Sum ZeroSum() {
+    Sum s = { _mm_setzero_pd(), _mm_setzero_pd() };
+    return s;
+  }
+  static Sum AddSum(Sum s, Vec v) {
+    s.lo = _mm_add_pd(s.lo, _mm_cvtps_pd(v));
+    s.hi = _mm_add_pd(s.hi, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    return s;
+  }
+  static double ReduceSum(Sum s) {
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(s.lo, s.hi));
+    return lanes[0] + lanes[1];
+  }
+  static uint32_t Compare(Vec a, Vec b, ColumnCompare op) {
+    Vec m;
+    switch (op) {
+      case kColumnLess: m = _mm_cmplt_ps(a, b); break;
+      case kColumnLessEqual: m = _mm_cmple_ps(a, b); break;
+      case kColumnGreater: m = _mm_cmpgt_ps(a, b); break;
+      case kColumnGreaterEqual: m = _mm_cmpge_ps(a, b); break;
+      case kColumnEqual: m = _mm_cmpeq_ps(a, b); break;
+      default: m = _mm_cmpneq_ps(a, b); break;
+    }
+    return static_cast<uint32_t>(_mm_movemask_ps(m));
+  }
+};
+
+struct Sse2Int32 {
+  typedef int32_t T;
+  typedef __m128i Vec;
+  typedef __m128i Sum;
+  static const size_t kLanes = 4;
+  static Vec Load(const Column<T> &col, size_t i) {
+    if (col.contiguous()) {
+      return _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(col.data() + i * sizeof(T)));
+    }
+    return _mm_setr_epi32(col[i], col[i + 1], col[i + 2], col[i + 3]);
+  }
+  static Vec Set(T value) { return _mm_set1_epi32(value); }
+  static void Store(T *lanes, Vec v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), v);
+  }
+  // SSE2 has no min/max of 32-bit integers.
+  static Vec Min(Vec a, Vec b) {
+    const auto gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+  }
+  static Vec Max(Vec a, Vec b) {
+    const auto gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+  static Sum ZeroSum() { return _mm_setzero_si128(); }
+  static Sum AddSum(Sum s, Vec v) {
+    // Sign extend to 64 bits.
+    const auto sign = _mm_srai_epi32(v, 31);
+    s = _mm_add_epi64(s, _mm_unpacklo_epi32(v, sign));
+    return _mm_add_epi64(s, _mm_unpackhi_epi32(v, sign));
+  }
+  static int64_t ReduceSum(Sum s) {
+    int64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), s);
+    return lanes[0] + lanes[1];
+  }
+  // Only <, > and == exist, the other comparisons are their negations.
+  static uint32_t Compare(Vec a, Vec b, ColumnCompare op) {
+    switch (op) {
+      case kColumnLess: return Mask(_mm_cmplt_epi32(a, b));
+      case kColumnLessEqual: return Mask(_mm_cmpgt_epi32(a, b)) ^ 0xF;
+      case kColumnGreater: return Mask(_mm_cmpgt_epi32(a, b));
+      case kColumnGreaterEqual: return Mask(_mm_cmplt_epi32(a, b)) ^ 0xF;
+      case kColumnEqual: return Mask(_mm_cmpeq_epi32(a, b));
+      default: return Mask(_mm_cmpeq_epi32(a, b)) ^ 0xF;
+    }
+  }
+  static uint32_t Mask(Vec m) {
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(m)));
+  }
+};
+// clang-format off
+#endif  // defined(FLATBUFFERS_VECTOR_KERNELS_SSE2)
+
+#if defined(FLATBUFFERS_VECTOR_KERNELS_AVX2)
+// clang-format on
+// Strided columns are read with gathers, with 32-bit offsets.
+inline bool Gatherable(size_t stride) {
+  const auto max = static_cast<size_t>((std::numeric_limits<int32_t>::max)());
+  return stride <= max / 8;
+}
+
+struct Avx2Float {
+  typedef float T;
+  typedef __m256 Vec;
+  struct Sum {
+    __m256d lo, hi;
+  };
+  static const size_t kLanes = 8;
+  FLATBUFFERS_TARGET_AVX2 static Vec Load(const Column<T> &col, size_t i) {
+    const auto p = col.data() + i * col.stride();
+    if (col.contiguous()) {
+      return _mm256_loadu_ps(reinterpret_cast<const float *>(p));
+    }
+    const auto s = static_cast<int32_t>(col.stride());
+    const auto offsets =
+        _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+    return _mm256_i32gather_ps(reinterpret_cast<const float *>(p), offsets, 1);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Vec Set(T value) {
+    return _mm256_set1_ps(value);
+  }
+  FLATBUFFERS_TARGET_AVX2 static void Store(T *lanes, Vec v) {
+    _mm256_storeu_ps(lanes, v);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Vec Min(Vec a, Vec b) {
+    return _mm256_min_ps(a, b);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Vec Max(Vec a, Vec b) {
+    return _mm256_max_ps(a, b);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Sum ZeroSum() {
+    Sum s = { _mm256_setzero_pd(), _mm256_setzero_pd() };
+    return s;
+  }
+  FLATBUFFERS_TARGET_AVX2 static Sum AddSum(Sum s, Vec v) {
+    s.lo = _mm256_add_pd(s.lo, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+    s.hi = _mm256_add_pd(s.hi, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    return s;
+  }
+  FLATBUFFERS_TARGET_AVX2 static double ReduceSum(Sum s) {
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(s.lo, s.hi));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+  FLATBUFFERS_TARGET_AVX2 static uint32_t Compare(Vec a, Vec b,
+                                                  ColumnCompare op) {
+    Vec m;
+    switch (op) {
+      case kColumnLess: m = _mm256_cmp_ps(a, b, _CMP_LT_OQ); break;
+      case kColumnLessEqual: m = _mm256_cmp_ps(a, b, _CMP_LE_OQ); break;
+      case kColumnGreater: m = _mm256_cmp_ps(a, b, _CMP_GT_OQ); break;
+      case kColumnGreaterEqual: m = _mm256_cmp_ps(a, b, _CMP_GE_OQ); break;
+      case kColumnEqual: m = _mm256_cmp_ps(a, b, _CMP_EQ_OQ); break;
+      default: m = _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); break;
+    }
+    return static_cast<uint32_t>(_mm256_movemask_ps(m));
+  }
+};
+
+struct Avx2Int32 {
+  typedef int32_t T;
+  typedef __m256i Vec;
+  typedef __m256i Sum;
+  static const size_t kLanes = 8;
+  FLATBUFFERS_TARGET_AVX2 static Vec Load(const Column<T> &col, size_t i) {
+    const auto p = col.data() + i * col.stride();
+    if (col.contiguous()) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+    const auto s = static_cast<int32_t>(col.stride());
+    const auto offsets =
+        _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+    return _mm256_i32gather_epi32(reinterpret_cast<const int *>(p), offsets,
+                                  1);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Vec Set(T value) {
+    return _mm256_set1_epi32(value);
+  }
+  FLATBUFFERS_TARGET_AVX2 static void Store(T *lanes, Vec v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), v);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Vec Min(Vec a, Vec b) {
+    return _mm256_min_epi32(a, b);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Vec Max(Vec a, Vec b) {
+    return _mm256_max_epi32(a, b);
+  }
+  FLATBUFFERS_TARGET_AVX2 static Sum ZeroSum() {
+    return _mm256_setzero_si256();
+  }
+  FLATBUFFERS_TARGET_AVX2 static Sum AddSum(Sum s, Vec v) {
+    s = _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    const auto hi = _mm256_extracti128_si256(v, 1);
+    return _mm256_add_epi64(s, _mm256_cvtepi32_epi64(hi));
+  }
+  FLATBUFFERS_TARGET_AVX2 static int64_t ReduceSum(Sum s) {
+    int64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), s);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+  // Only > and == exist, the other comparisons are built from them.
+  FLATBUFFERS_TARGET_AVX2 static uint32_t Compare(Vec a, Vec b,
+                                                  ColumnCompare op) {
+    switch (op) {
+      case kColumnLess: return Mask(_mm256_cmpgt_epi32(b, a));
+      case kColumnLessEqual: return Mask(_mm256_cmpgt_epi32(a, b)) ^ 0xFF;
+      case kColumnGreater: return Mask(_mm256_cmpgt_epi32(a, b));
+      case kColumnGreaterEqual: return Mask(_mm256_cmpgt_epi32(b, a)) ^ 0xFF;
+      case kColumnEqual: return Mask(_mm256_cmpeq_epi32(a, b));
+      default: return Mask(_mm256_cmpeq_epi32(a, b)) ^ 0xFF;
+    }
+  }
+  FLATBUFFERS_TARGET_AVX2 static uint32_t Mask(Vec m) {
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+  }
+};
+
+FLATBUFFERS_SIMD_KERNELS(Avx2Kernels, FLATBUFFERS_TARGET_AVX2)
+// clang-format off
+#else
+  // Not used, but keeps the dispatch below the same.
+  template<typename V> struct Avx2Kernels : SimdKernels<V> {};
+#endif  // defined(FLATBUFFERS_VECTOR_KERNELS_AVX2)
+// clang-format on
+
+// Scalar kernels, for any type.
+template<typename T> struct ScalarKernels {
+  typedef typename ColumnSumOf<T>::type S;
+
+  static S Sum(const Column<T> &col) {
+    S sum = 0;
+    for (size_t i = 0; i < col.size(); i++) sum += col[i];
+    return sum;
+  }
+
+  template<bool kMin> static T MinMax(const Column<T> &col, T init) {
+    T result = init;
+    for (size_t i = 0; i < col.size(); i++) {
+      result = kMin ? (std::min)(result, col[i]) : (std::max)(result, col[i]);
+    }
+    return result;
+  }
+
+  static size_t CountIf(const Column<T> &col, ColumnCompare op, T value) {
+    size_t count = 0;
+    for (size_t i = 0; i < col.size(); i++) count += Compare(col[i], value, op);
+    return count;
+  }
+
+  static void Filter(const Column<T> &col, ColumnCompare op, T value,
+                     std::vector<uoffset_t> *indices) {
+    for (size_t i = 0; i < col.size(); i++) {
+      if (Compare(col[i], value, op)) {
+        indices->push_back(static_cast<uoffset_t>(i));
+      }
+    }
+  }
+};
+
+template<typename T> struct ColumnKernels : ScalarKernels<T> {};
+
+// clang-format off
+#if defined(FLATBUFFERS_VECTOR_KERNELS_SSE2)
+// clang-format on
+// Kernels for `Sse2::T`, picking the instruction set for each column.
+template<typename Sse2, typename Avx2> struct SimdColumnKernels {
+  typedef typename Sse2::T T;
+  typedef typename ColumnSumOf<T>::type S;
+
+  static ColumnIsa IsaFor(const Column<T> &col) {
+    const auto isa = (std::min)(DetectColumnIsa(), MaxColumnIsa());
+    // clang-format off
+    #if defined(FLATBUFFERS_VECTOR_KERNELS_AVX2)
+      if (isa == kColumnAVX2 && !Gatherable(col.stride())) return kColumnSSE2;
+    #else
+      (void)col;
+    #endif
+    // clang-format on
+    return isa;
+  }
+
+  static S Sum(const Column<T> &col) {
+    switch (IsaFor(col)) {
+      case kColumnAVX2: return Avx2Kernels<Avx2>::Sum(col);
+      case kColumnSSE2: return SimdKernels<Sse2>::Sum(col);
+      default: return ScalarKernels<T>::Sum(col);
+    }
+  }
+
+  template<bool kMin> static T MinMax(const Column<T> &col, T init) {
+    switch (IsaFor(col)) {
+      case kColumnAVX2:
+        return Avx2Kernels<Avx2>::template MinMax<kMin>(col, init);
+      case kColumnSSE2:
+        return SimdKernels<Sse2>::template MinMax<kMin>(col, init);
+      default: return ScalarKernels<T>::template MinMax<kMin>(col, init);
+    }
+  }
+
+  static size_t CountIf(const Column<T> &col, ColumnCompare op, T value) {
+    switch (IsaFor(col)) {
+      case kColumnAVX2: return Avx2Kernels<Avx2>::CountIf(col, op, value);
+      case kColumnSSE2: return SimdKernels<Sse2>::CountIf(col, op, value);
+      default: return ScalarKernels<T>::CountIf(col, op, value);
+    }
+  }
+
+  static void Filter(const Column<T> &col, ColumnCompare op, T value,
+                     std::vector<uoffset_t> *indices) {
+    switch (IsaFor(col)) {
+      case kColumnAVX2:
+        return Avx2Kernels<Avx2>::Filter(col, op, value, indices);
+      case kColumnSSE2:
+        return SimdKernels<Sse2>::Filter(col, op, value, indices);
+      default: return ScalarKernels<T>::Filter(col, op, value, indices);
+    }
+  }
+};
+
+// clang-format off
+#if defined(FLATBUFFERS_VECTOR_KERNELS_AVX2)
+  template<> struct ColumnKernels<float>
+      : SimdColumnKernels<Sse2Float, Avx2Float> {};
+  template<> struct ColumnKernels<int32_t>
+      : SimdColumnKernels<Sse2Int32, Avx2Int32> {};
+#else
+  template<> struct ColumnKernels<float>
+      : SimdColumnKernels<Sse2Float, Sse2Float> {};
+  template<> struct ColumnKernels<int32_t>
+      : SimdColumnKernels<Sse2Int32, Sse2Int32> {};
+#endif
+#endif  // defined(FLATBUFFERS_VECTOR_KERNELS_SSE2)
+// clang-format on
+
+template<typename T> T LargestValue() {
+  return std::numeric_limits<T>::has_infinity
+             ? std::numeric_limits<T>::infinity()
+             : (std::numeric_limits<T>::max)();
+}
+
+template<typename T> T SmallestValue() {
+  return std::numeric_limits<T>::has_infinity
+             ? static_cast<T>(-std::numeric_limits<T>::infinity())
+             : std::numeric_limits<T>::lowest();
+}
+
+}  // namespace detail
+/// @endcond
+
+// Limits the instruction set used by the kernels below, e.g. to compare them
+// with each other. They use the best one the CPU supports by default.
+inline void SetMaxColumnIsa(ColumnIsa isa) { detail::MaxColumnIsa() = isa; }
+
+// The instruction set used by the kernels below for contiguous columns.
+inline ColumnIsa GetColumnIsa() {
+  return (std::min)(detail::DetectColumnIsa(), detail::MaxColumnIsa());
+}
+
+// The sum of the elements, as a 64-bit integer or a double. Floats are added
+// in a different order depending on the instruction set, so their sums may
+// differ in the last bits.
+template<typename T>
+typename detail::ColumnSumOf<T>::type ColumnSum(const Column<T> &col) {
+  return detail::ColumnKernels<T>::Sum(col);
+}
+
+// The smallest element, or the largest value of T (infinity for floats) if
+// there are none. The result is unspecified if there are NaNs.
+template<typename T> T ColumnMin(const Column<T> &col) {
+  return detail::ColumnKernels<T>::template MinMax<true>(
+      col, detail::LargestValue<T>());
+}
+
+// The largest element, or the smallest value of T (-infinity for floats) if
+// there are none. The result is unspecified if there are NaNs.
+template<typename T> T ColumnMax(const Column<T> &col) {
+  return detail::ColumnKernels<T>::template MinMax<false>(
+      col, detail::SmallestValue<T>());
+}
+
+// The number of elements `e` for which `e op value` is true.
+template<typename T>
+size_t ColumnCountIf(const Column<T> &col, ColumnCompare op, T value) {
+  return detail::ColumnKernels<T>::CountIf(col, op, value);
+}
+
+// Appends the indices of the elements `e` for which `e op value` is true to
+// `indices`, in increasing order.
+template<typename T>
+void ColumnFilter(const Column<T> &col, ColumnCompare op, T value,
+                  std::vector<uoffset_t> *indices) {
+  detail::ColumnKernels<T>::Filter(col, op, value, indices);
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_VECTOR_KERNELS_H_
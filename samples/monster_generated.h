@@ -134,6 +134,7 @@ struct EquipmentUnion {
 
   static void *UnPack(const void *obj, Equipment type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
 
   MyGame::Sample::WeaponT *AsWeapon() {
     return type == Equipment_Weapon ?
@@ -179,6 +180,11 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3 FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return Vec3TypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_X = 0,
+    OFFSET_Y = 4,
+    OFFSET_Z = 8
+  };
   Vec3()
       : x_(0),
         y_(0),
@@ -463,6 +469,7 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(
 }
 
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterT &_o);
 
 struct WeaponT : public flatbuffers::NativeTable {
   typedef Weapon TableType;
@@ -558,6 +565,7 @@ inline flatbuffers::Offset<Weapon> CreateWeaponDirect(
 }
 
 flatbuffers::Offset<Weapon> CreateWeapon(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const WeaponT &_o);
 
 inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<MonsterT>(new MonsterT());
@@ -580,7 +588,20 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
   { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } }
 }
 
+inline size_t GetPackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(11, 58);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.name.length());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.inventory.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.weapons.size(), 4, 4);
+  for (const auto &_e : _o.weapons) _size += GetPackedSizeUpperBound(*_e.get());
+  _size += _o.equipped.GetPackedSizeUpperBound();
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.path.size(), 12, 4);
+  return _size;
+}
+
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
@@ -625,7 +646,15 @@ inline void Weapon::UnPackTo(WeaponT *_o, const flatbuffers::resolver_function_t
   { auto _e = damage(); _o->damage = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const WeaponT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(2, 10);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.name.length());
+  return _size;
+}
+
 inline flatbuffers::Offset<Weapon> Weapon::Pack(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateWeapon(_fbb, _o, _rehasher);
 }
 
@@ -686,6 +715,16 @@ inline flatbuffers::Offset<void> EquipmentUnion::Pack(flatbuffers::FlatBufferBui
   }
 }
 
+inline size_t EquipmentUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case Equipment_Weapon: {
+      auto ptr = reinterpret_cast<const MyGame::Sample::WeaponT *>(value);
+      return ::MyGame::Sample::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline EquipmentUnion::EquipmentUnion(const EquipmentUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Equipment_Weapon: {
@@ -686,6 +686,15 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // Like GenTypeWire, for the type of a table field, which may refer to its
+  // data with a 64-bit offset.
+  std::string GenFieldTypeWire(const FieldDef &field,
+                               const char *postfix) const {
+    if (!field.offset64) return GenTypeWire(field.value.type, postfix, true);
+    return "flatbuffers::Offset64<" + GenTypePointer(field.value.type) + ">" +
+           postfix;
+  }
+
   // Return a C++ type for any type (scalar/pointer) that reflects its
   // serialized size.
   std::string GenTypeSize(const Type &type) const {
@@ -947,6 +956,17 @@ class CppGenerator : public BaseGenerator {
            (inclass ? " = nullptr" : "") + ")";
   }
 
+  std::string TablePackedSizeSignature(const StructDef &struct_def,
+                                       const IDLOptions &opts) {
+    return "size_t GetPackedSizeUpperBound(const " +
+           NativeName(Name(struct_def), &struct_def, opts) + " &_o)";
+  }
+
+  std::string UnionPackedSizeSignature(const EnumDef &enum_def, bool inclass) {
+    return "size_t " + (inclass ? "" : Name(enum_def) + "Union::") +
+           "GetPackedSizeUpperBound() const";
+  }
+
   std::string TableUnPackSignature(const StructDef &struct_def, bool inclass,
                                    const IDLOptions &opts) {
     return NativeName(Name(struct_def), &struct_def, opts) + " *" +
@@ -1320,6 +1340,7 @@ class CppGenerator : public BaseGenerator {
       }
       code_ += "  " + UnionUnPackSignature(enum_def, true) + ";";
       code_ += "  " + UnionPackSignature(enum_def, true) + ";";
+      code_ += "  " + UnionPackedSizeSignature(enum_def, true) + ";";
       code_ += "";
 
       for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end();
@@ -1521,6 +1542,48 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      code_ += "inline " + UnionPackedSizeSignature(enum_def, false) + " {";
+      code_ += "  switch (type) {";
+      for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end();
+           ++it) {
+        auto &ev = **it;
+        if (ev.IsZero()) { continue; }
+
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+        code_.SetValue("TYPE", GetUnionElement(ev, true, opts_));
+        code_ += "    case {{LABEL}}: {";
+        if (ev.union_type.base_type == BASE_TYPE_STRUCT &&
+            ev.union_type.struct_def->fixed) {
+          code_.SetValue("SIZE",
+                         NumToString(InlineSize(ev.union_type) +
+                                     InlineAlignment(ev.union_type) - 1));
+          code_ += "      return {{SIZE}};";
+        } else {
+          code_ +=
+              "      auto ptr = reinterpret_cast<const {{TYPE}} *>(value);";
+          if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+            // Qualified, as the member function hides the global ones.
+            const auto qualified_name =
+                ev.union_type.struct_def->defined_namespace
+                    ->GetFullyQualifiedName("GetPackedSizeUpperBound");
+            code_.SetValue("SIZE_NAME",
+                           "::" + TranslateNameSpace(qualified_name));
+            code_ += "      return {{SIZE_NAME}}(*ptr);";
+          } else if (IsString(ev.union_type)) {
+            code_ +=
+                "      return flatbuffers::FlatBufferBuilder::"
+                "StringSizeUpperBound(ptr->length());";
+          } else {
+            FLATBUFFERS_ASSERT(false);
+          }
+        }
+        code_ += "    }";
+      }
+      code_ += "    default: return 0;";
+      code_ += "  }";
+      code_ += "}";
+      code_ += "";
+
       // Union copy constructor
       code_ +=
           "inline {{ENUM_NAME}}Union::{{ENUM_NAME}}Union(const "
@@ -1615,6 +1678,12 @@ class CppGenerator : public BaseGenerator {
     return "VT_" + uname;
   }
 
+  std::string GenStructFieldOffsetName(const FieldDef &field) {
+    std::string uname = Name(field);
+    std::transform(uname.begin(), uname.end(), uname.begin(), CharToUpper);
+    return "OFFSET_" + uname;
+  }
+
   void GenFullyQualifiedNameGetter(const StructDef &struct_def,
                                    const std::string &name) {
     if (!opts_.generate_name_strings) { return; }
@@ -1689,7 +1758,7 @@ class CppGenerator : public BaseGenerator {
       if (field.IsScalarOptional())
         code_.SetValue("PARAM_TYPE", GenOptionalDecl(type) + " ");
       else
-        code_.SetValue("PARAM_TYPE", GenTypeWire(type, " ", true));
+        code_.SetValue("PARAM_TYPE", GenFieldTypeWire(field, " "));
     }
     code_ += "{{PRE}}{{PARAM_TYPE}}{{PARAM_NAME}} = {{PARAM_VALUE}}\\";
   }
@@ -1873,11 +1942,12 @@ class CppGenerator : public BaseGenerator {
     code_.SetValue("REQUIRED", field.IsRequired() ? "Required" : "");
     code_.SetValue("SIZE", GenTypeSize(field.value.type));
     code_.SetValue("OFFSET", GenFieldOffsetName(field));
+    code_.SetValue("64", field.offset64 ? "64" : "");
     if (IsScalar(field.value.type.base_type) || IsStruct(field.value.type)) {
       code_ +=
           "{{PRE}}VerifyField{{REQUIRED}}<{{SIZE}}>(verifier, {{OFFSET}})\\";
     } else {
-      code_ += "{{PRE}}VerifyOffset{{REQUIRED}}(verifier, {{OFFSET}})\\";
+      code_ += "{{PRE}}VerifyOffset{{64}}{{REQUIRED}}(verifier, {{OFFSET}})\\";
     }
 
     switch (field.value.type.base_type) {
@@ -1896,11 +1966,11 @@ class CppGenerator : public BaseGenerator {
         break;
       }
       case BASE_TYPE_STRING: {
-        code_ += "{{PRE}}verifier.VerifyString({{NAME}}())\\";
+        code_ += "{{PRE}}verifier.VerifyString{{64}}({{NAME}}())\\";
         break;
       }
       case BASE_TYPE_VECTOR: {
-        code_ += "{{PRE}}verifier.VerifyVector({{NAME}}())\\";
+        code_ += "{{PRE}}verifier.VerifyVector{{64}}({{NAME}}())\\";
 
         switch (field.value.type.element) {
           case BASE_TYPE_STRING: {
@@ -1963,6 +2033,19 @@ class CppGenerator : public BaseGenerator {
           "static_cast<int>({{FIELD_NAME}}() < val);";
       code_ += "  }";
     }
+
+    // The key as stored, which builders extract to sort by it.
+    if (is_string) {
+      code_ += "  const flatbuffers::String *GetKey() const {";
+      code_ += "    return {{FIELD_NAME}}();";
+    } else {
+      code_.SetValue("KEY_TYPE", GenTypeBasic(field.value.type, false));
+      code_.SetValue("KEY_VALUE",
+                     GenUnderlyingCast(field, false, Name(field) + "()"));
+      code_ += "  {{KEY_TYPE}} GetKey() const {";
+      code_ += "    return {{KEY_VALUE}};";
+    }
+    code_ += "  }";
   }
 
   void GenTableUnionAsGetters(const FieldDef &field) {
@@ -2011,6 +2094,8 @@ class CppGenerator : public BaseGenerator {
         accessor = "GetField<";
       else if (IsStruct(type))
         accessor = "GetStruct<";
+      else if (field.offset64)
+        accessor = "GetPointer64<";
       else
         accessor = "GetPointer<";
       auto offset_type = GenTypeGet(type, "", "const ", " *", false);
@@ -2200,7 +2285,9 @@ class CppGenerator : public BaseGenerator {
     } else {
       auto postptr = " *" + NullableExtension();
       auto wire_type = GenTypeGet(type, " ", "", postptr.c_str(), true);
-      std::string accessor = IsStruct(type) ? "GetStruct<" : "GetPointer<";
+      std::string accessor = IsStruct(type)    ? "GetStruct<"
+                             : field.offset64 ? "GetPointer64<"
+                                              : "GetPointer<";
       auto underlying = accessor + wire_type + ">(" + offset_str + ")";
       code_.SetValue("FIELD_TYPE", wire_type);
       code_.SetValue("FIELD_VALUE", GenUnderlyingCast(field, true, underlying));
@@ -2306,6 +2393,32 @@ class CppGenerator : public BaseGenerator {
         code_ += "  }";
       }
 
+      if (field.attributes.Lookup("eytzinger")) {
+        code_.SetValue("ELEMENT_TYPE",
+                       GenTypeWire(field.value.type.VectorType(), "", false));
+        code_ +=
+            "  flatbuffers::EytzingerVector<{{ELEMENT_TYPE}}> "
+            "{{FIELD_NAME}}_by_key() const {";
+        code_ +=
+            "    return flatbuffers::EytzingerVector<{{ELEMENT_TYPE}}>("
+            "{{FIELD_NAME}}());";
+        code_ += "  }";
+      }
+
+      if (field.attributes.Lookup("hash_index")) {
+        code_.SetValue(
+            "CPP_NAME",
+            WrapInNameSpace(*field.value.type.VectorType().struct_def));
+        code_ +=
+            "  const {{CPP_NAME}} *{{FIELD_NAME}}_by_key_hashed("
+            "const char *key) const {";
+        code_ +=
+            "    return flatbuffers::LookupByKeyHashed({{FIELD_NAME}}(), "
+            "{{FIELD_NAME}}" +
+            std::string(HashIndexFieldSuffix()) + "(), key);";
+        code_ += "  }";
+      }
+
       // Generate a comparison function for this field if it is a key.
       if (field.key) { GenKeyFieldMethods(field); }
     }
@@ -2379,6 +2492,7 @@ class CppGenerator : public BaseGenerator {
       // Generate a pre-declaration for a CreateX method that works with an
       // unpacked C++ object.
       code_ += TableCreateSignature(struct_def, true, opts_) + ";";
+      code_ += TablePackedSizeSignature(struct_def, opts_) + ";";
       code_ += "";
     }
   }
@@ -2396,12 +2510,186 @@ class CppGenerator : public BaseGenerator {
       const auto vtype = field.value.type.VectorType();
       const auto type = IsStruct(vtype) ? WrapInNameSpace(*vtype.struct_def)
                                         : GenTypeWire(vtype, "", false);
-      return "_fbb.ForceVectorAlignment(" + field_size + ", sizeof(" + type +
-             "), " + std::to_string(static_cast<long long>(align)) + ");";
+      return "_fbb.ForceVectorAlignment" +
+             std::string(field.offset64 ? "64" : "") + "(" + field_size +
+             ", sizeof(" + type + "), " +
+             std::to_string(static_cast<long long>(align)) + ");";
     }
     return "";
   }
 
+  // The vector with the `hash_index` attribute whose index `field` holds, if
+  // `field` is such an auto-generated index.
+  static const FieldDef *HashIndexedField(const StructDef &struct_def,
+                                          const FieldDef &field) {
+    const std::string suffix = HashIndexFieldSuffix();
+    const auto &name = field.name;
+    if (name.length() <= suffix.length() ||
+        name.compare(name.length() - suffix.length(), suffix.length(),
+                     suffix) != 0)
+      return nullptr;
+    auto indexed = struct_def.fields.Lookup(
+        name.substr(0, name.length() - suffix.length()));
+    return indexed && indexed->attributes.Lookup("hash_index") ? indexed
+                                                                : nullptr;
+  }
+
+  // Generate the code to create the data of a field for CreateXDirect.
+  void GenCreateDirectParam(const FieldDef &field) {
+    code_.SetValue("FIELD_NAME", Name(field));
+    code_.SetValue("64", field.offset64 ? "64" : "");
+    if (IsString(field.value.type)) {
+      if (field.offset64) {
+        code_.SetValue("CREATE_STRING", "CreateString64");
+      } else if (!field.shared) {
+        code_.SetValue("CREATE_STRING", "CreateString");
+      } else {
+        code_.SetValue("CREATE_STRING", "CreateSharedString");
+      }
+      code_ +=
+          "  auto {{FIELD_NAME}}__ = {{FIELD_NAME}} ? "
+          "_fbb.{{CREATE_STRING}}({{FIELD_NAME}}) : 0;";
+    } else if (IsVector(field.value.type)) {
+      const std::string force_align_code =
+          GenVectorForceAlign(field, Name(field) + "->size()");
+      if (!force_align_code.empty()) {
+        code_ += "  if ({{FIELD_NAME}}) { " + force_align_code + " }";
+      }
+      code_ += "  auto {{FIELD_NAME}}__ = {{FIELD_NAME}} ? \\";
+      const auto vtype = field.value.type.VectorType();
+      const auto has_key = TypeHasKey(vtype);
+      if (field.attributes.Lookup("eytzinger")) {
+        const auto type = WrapInNameSpace(*vtype.struct_def);
+        code_ += (IsStruct(vtype) ? "_fbb.CreateVectorOfEytzingerStructs<"
+                                  : "_fbb.CreateVectorOfEytzingerTables<") +
+                 type + ">(*{{FIELD_NAME}}) : 0;";
+        return;
+      }
+      if (IsStruct(vtype)) {
+        const auto type = WrapInNameSpace(*vtype.struct_def);
+        code_ += (has_key ? "_fbb.CreateVectorOfSortedStructs<"
+                          : "_fbb.CreateVectorOfStructs{{64}}<") +
+                 type + ">\\";
+      } else if (has_key) {
+        const auto type = WrapInNameSpace(*vtype.struct_def);
+        code_ += "_fbb.CreateVectorOfSortedTables<" + type + ">\\";
+      } else {
+        const auto type =
+            GenTypeWire(vtype, "", VectorElementUserFacing(vtype));
+        code_ += "_fbb.CreateVector{{64}}<" + type + ">\\";
+      }
+      code_ +=
+          has_key ? "({{FIELD_NAME}}) : 0;" : "(*{{FIELD_NAME}}) : 0;";
+    }
+  }
+
+  // Body of CreateX() for regular tables, which uses the XBuilder.
+  void GenBuilderCreate(const StructDef &struct_def) {
+    code_ += "  {{STRUCT_NAME}}Builder builder_(_fbb);";
+    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
+         size; size /= 2) {
+      for (auto it = struct_def.fields.vec.rbegin();
+           it != struct_def.fields.vec.rend(); ++it) {
+        const auto &field = **it;
+        const auto field_size = field.offset64
+                                    ? sizeof(uoffset64_t)
+                                    : SizeOf(field.value.type.base_type);
+        if (!field.deprecated &&
+            (!struct_def.sortbysize || size == field_size)) {
+          code_.SetValue("FIELD_NAME", Name(field));
+          if (field.IsScalarOptional()) {
+            code_ +=
+                "  if({{FIELD_NAME}}) { "
+                "builder_.add_{{FIELD_NAME}}(*{{FIELD_NAME}}); }";
+          } else {
+            code_ += "  builder_.add_{{FIELD_NAME}}({{FIELD_NAME}});";
+          }
+        }
+      }
+    }
+    code_ += "  return builder_.Finish();";
+  }
+
+  // Body of CreateX() for tables with the precomputed_vtable attribute: all
+  // fields are written, so their layout and the vtable can be computed here,
+  // and the table is created with a single allocation.
+  void GenPrecomputedCreate(const StructDef &struct_def) {
+    // Lay the fields out by decreasing alignment, and in reverse order
+    // otherwise. The field pushed first ends up at the end of the table.
+    // Tables written field by field may be laid out differently (e.g. with
+    // padding in front), in which case they get vtables of their own.
+    std::vector<const FieldDef *> fields;
+    for (auto it = struct_def.fields.vec.rbegin();
+         it != struct_def.fields.vec.rend(); ++it) {
+      if (!(*it)->deprecated) fields.push_back(*it);
+    }
+    std::stable_sort(fields.begin(), fields.end(),
+                     [](const FieldDef *a, const FieldDef *b) {
+                       return InlineAlignment(a->value.type) >
+                              InlineAlignment(b->value.type);
+                     });
+    size_t fields_size = 0;
+    size_t align = sizeof(soffset_t);
+    voffset_t vt_size = FieldIndexToOffset(0);
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      fields_size += InlineSize((*it)->value.type);
+      align = (std::max)(align, InlineAlignment((*it)->value.type));
+      vt_size = (std::max)(
+          vt_size, static_cast<voffset_t>((*it)->value.offset +
+                                          sizeof(voffset_t)));
+    }
+    const auto padding = PaddingBytes(fields_size, sizeof(soffset_t));
+    const auto table_size = sizeof(soffset_t) + padding + fields_size;
+    std::vector<voffset_t> vtable(vt_size / sizeof(voffset_t), 0);
+    vtable[0] = vt_size;
+    vtable[1] = static_cast<voffset_t>(table_size);
+    std::vector<size_t> positions;
+    auto pos = table_size;
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      pos -= InlineSize((*it)->value.type);
+      positions.push_back(pos);
+      vtable[(*it)->value.offset / sizeof(voffset_t)] =
+          static_cast<voffset_t>(pos);
+    }
+    std::string vtable_init;
+    for (auto it = vtable.begin(); it != vtable.end(); ++it) {
+      if (it != vtable.begin()) vtable_init += ", ";
+      vtable_init += NumToString(*it);
+    }
+
+    code_.SetValue("VTABLE", vtable_init);
+    code_.SetValue("TABLE_SIZE", NumToString(table_size));
+    code_.SetValue("TABLE_ALIGN", NumToString(align));
+    code_ +=
+        "  static FLATBUFFERS_CONSTEXPR flatbuffers::voffset_t vtable[] = { "
+        "{{VTABLE}} };";
+    code_ +=
+        "  auto _p = _fbb.StartFixedTable({{TABLE_SIZE}}, {{TABLE_ALIGN}});";
+    if (padding) {
+      code_.SetValue("PADDING", NumToString(padding));
+      code_ +=
+          "  memset(_p + sizeof(flatbuffers::soffset_t), 0, {{PADDING}});";
+    }
+    for (size_t i = 0; i < fields.size(); i++) {
+      const auto &field = *fields[i];
+      code_.SetValue("FIELD_POS", NumToString(positions[i]));
+      if (IsStruct(field.value.type)) {
+        code_.SetValue("FIELD_NAME", Name(field));
+        code_ += "  _fbb.SetFixedStruct(_p, {{FIELD_POS}}, {{FIELD_NAME}});";
+      } else {
+        code_.SetValue("FIELD_TYPE", GenTypeWire(field.value.type, "", false));
+        code_.SetValue("FIELD_VALUE",
+                       GenUnderlyingCast(field, false, Name(field)));
+        code_ +=
+            "  flatbuffers::WriteScalar<{{FIELD_TYPE}}>(_p + {{FIELD_POS}}, "
+            "{{FIELD_VALUE}});";
+      }
+    }
+    code_ +=
+        "  return flatbuffers::Offset<{{STRUCT_NAME}}>("
+        "_fbb.EndFixedTable(vtable));";
+  }
+
   void GenBuilders(const StructDef &struct_def) {
     code_.SetValue("STRUCT_NAME", Name(struct_def));
 
@@ -2431,7 +2719,7 @@ class CppGenerator : public BaseGenerator {
       //   fbb_.AddElement<type>(offset, name, default);
       // }
       code_.SetValue("FIELD_NAME", Name(field));
-      code_.SetValue("FIELD_TYPE", GenTypeWire(field.value.type, " ", true));
+      code_.SetValue("FIELD_TYPE", GenFieldTypeWire(field, " "));
       code_.SetValue("ADD_OFFSET", Name(struct_def) + "::" + offset);
       code_.SetValue("ADD_NAME", name);
       code_.SetValue("ADD_VALUE", value);
@@ -2494,26 +2782,11 @@ class CppGenerator : public BaseGenerator {
     }
     code_ += ") {";
 
-    code_ += "  {{STRUCT_NAME}}Builder builder_(_fbb);";
-    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
-         size; size /= 2) {
-      for (auto it = struct_def.fields.vec.rbegin();
-           it != struct_def.fields.vec.rend(); ++it) {
-        const auto &field = **it;
-        if (!field.deprecated && (!struct_def.sortbysize ||
-                                  size == SizeOf(field.value.type.base_type))) {
-          code_.SetValue("FIELD_NAME", Name(field));
-          if (field.IsScalarOptional()) {
-            code_ +=
-                "  if({{FIELD_NAME}}) { "
-                "builder_.add_{{FIELD_NAME}}(*{{FIELD_NAME}}); }";
-          } else {
-            code_ += "  builder_.add_{{FIELD_NAME}}({{FIELD_NAME}});";
-          }
-        }
-      }
+    if (struct_def.attributes.Lookup("precomputed_vtable")) {
+      GenPrecomputedCreate(struct_def);
+    } else {
+      GenBuilderCreate(struct_def);
     }
-    code_ += "  return builder_.Finish();";
     code_ += "}";
     code_ += "";
 
@@ -2530,51 +2803,31 @@ class CppGenerator : public BaseGenerator {
       for (auto it = struct_def.fields.vec.begin();
            it != struct_def.fields.vec.end(); ++it) {
         const auto &field = **it;
-        if (!field.deprecated) { GenParam(field, true, ",\n    "); }
+        if (!field.deprecated && !HashIndexedField(struct_def, field)) {
+          GenParam(field, true, ",\n    ");
+        }
       }
       // Need to call "Create" with the struct namespace.
       const auto qualified_create_name =
           struct_def.defined_namespace->GetFullyQualifiedName("Create");
       code_.SetValue("CREATE_NAME", TranslateNameSpace(qualified_create_name));
       code_ += ") {";
-      for (auto it = struct_def.fields.vec.begin();
-           it != struct_def.fields.vec.end(); ++it) {
-        const auto &field = **it;
-        if (!field.deprecated) {
-          code_.SetValue("FIELD_NAME", Name(field));
-          if (IsString(field.value.type)) {
-            if (!field.shared) {
-              code_.SetValue("CREATE_STRING", "CreateString");
-            } else {
-              code_.SetValue("CREATE_STRING", "CreateSharedString");
-            }
-            code_ +=
-                "  auto {{FIELD_NAME}}__ = {{FIELD_NAME}} ? "
-                "_fbb.{{CREATE_STRING}}({{FIELD_NAME}}) : 0;";
-          } else if (IsVector(field.value.type)) {
-            const std::string force_align_code =
-                GenVectorForceAlign(field, Name(field) + "->size()");
-            if (!force_align_code.empty()) {
-              code_ += "  if ({{FIELD_NAME}}) { " + force_align_code + " }";
-            }
-            code_ += "  auto {{FIELD_NAME}}__ = {{FIELD_NAME}} ? \\";
-            const auto vtype = field.value.type.VectorType();
-            const auto has_key = TypeHasKey(vtype);
-            if (IsStruct(vtype)) {
-              const auto type = WrapInNameSpace(*vtype.struct_def);
-              code_ += (has_key ? "_fbb.CreateVectorOfSortedStructs<"
-                                : "_fbb.CreateVectorOfStructs<") +
-                       type + ">\\";
-            } else if (has_key) {
-              const auto type = WrapInNameSpace(*vtype.struct_def);
-              code_ += "_fbb.CreateVectorOfSortedTables<" + type + ">\\";
-            } else {
-              const auto type =
-                  GenTypeWire(vtype, "", VectorElementUserFacing(vtype));
-              code_ += "_fbb.CreateVector<" + type + ">\\";
-            }
+      // Data referred to by 64-bit offsets has to be created first.
+      for (int pass = 0; pass < 2; pass++) {
+        for (auto it = struct_def.fields.vec.begin();
+             it != struct_def.fields.vec.end(); ++it) {
+          const auto &field = **it;
+          if (field.deprecated || field.offset64 != (pass == 0)) continue;
+          // Hash indices are computed from the vector they index.
+          const auto indexed = HashIndexedField(struct_def, field);
+          if (indexed) {
+            code_.SetValue("FIELD_NAME", Name(field));
+            code_.SetValue("INDEXED_NAME", Name(*indexed));
             code_ +=
-                has_key ? "({{FIELD_NAME}}) : 0;" : "(*{{FIELD_NAME}}) : 0;";
+                "  auto {{FIELD_NAME}}__ = {{INDEXED_NAME}} ? "
+                "_fbb.CreateKeyHashIndex({{INDEXED_NAME}}__) : 0;";
+          } else {
+            GenCreateDirectParam(field);
           }
         }
       }
@@ -2791,6 +3044,36 @@ class CppGenerator : public BaseGenerator {
     }
 
     std::string code;
+    if (field.offset64) {
+      // Only strings and vectors of scalars or (non-native) structs, of the
+      // forms:
+      //   _fbb.CreateString64(_o->field)
+      //   _fbb.CreateVector64(_o->field)
+      //   _fbb.CreateVectorOfStructs64(_o->field)
+      const auto &type = field.value.type;
+      const auto vector_type = type.VectorType();
+      if (IsString(type)) {
+        code = "_fbb.CreateString64(" + value + ")";
+        if (opts_.set_empty_strings_to_null && !field.IsRequired()) {
+          code = value + ".empty() ? 0 : " + code;
+        }
+        return code;
+      }
+      if (IsStruct(vector_type)) {
+        code = "_fbb.CreateVectorOfStructs64(" + value + ")";
+      } else if (type.enum_def && !VectorElementUserFacing(vector_type)) {
+        const auto basetype =
+            GenTypeBasic(type.enum_def->underlying_type, false);
+        code = "_fbb.CreateVectorScalarCast64<" + basetype +
+               ">(flatbuffers::data(" + value + "), " + value + ".size())";
+      } else {
+        code = "_fbb.CreateVector64(" + value + ")";
+      }
+      if (opts_.set_empty_vectors_to_null && !field.IsRequired()) {
+        code = value + ".size() ? " + code + " : 0";
+      }
+      return code;
+    }
     switch (field.value.type.base_type) {
       // String fields are of the form:
       //   _fbb.CreateString(_o->field)
@@ -2852,13 +3135,21 @@ class CppGenerator : public BaseGenerator {
               if (native_type) {
                 code += "_fbb.CreateVectorOfNativeStructs<";
                 code += WrapInNameSpace(*vector_type.struct_def) + ">";
+              } else if (field.attributes.Lookup("eytzinger")) {
+                code += "_fbb.CreateVectorOfEytzingerStructs";
               } else {
                 code += "_fbb.CreateVectorOfStructs";
               }
               code += "(" + value + ")";
             } else {
-              code += "_fbb.CreateVector<flatbuffers::Offset<";
-              code += WrapInNameSpace(*vector_type.struct_def) + ">> ";
+              // Eytzinger order is restored whatever order the objects are in.
+              if (field.attributes.Lookup("eytzinger")) {
+                code += "_fbb.CreateVectorOfEytzingerTables<";
+                code += WrapInNameSpace(*vector_type.struct_def) + "> ";
+              } else {
+                code += "_fbb.CreateVector<flatbuffers::Offset<";
+                code += WrapInNameSpace(*vector_type.struct_def) + ">> ";
+              }
               code += "(" + value + ".size(), ";
               code += "[](size_t i, _VectorArgs *__va) { ";
               code += "return Create" + vector_type.struct_def->name;
@@ -2956,6 +3247,55 @@ class CppGenerator : public BaseGenerator {
     return code;
   }
 
+  // Generate the statement that adds an upper bound of the space taken up
+  // by the out-of-line data of a field of _o to _size, if it has any.
+  std::string GenPackedSizeField(const FieldDef &field) {
+    const auto value = "_o." + Name(field);
+    const std::string bound = "flatbuffers::FlatBufferBuilder::";
+    const auto &type = field.value.type;
+    switch (type.base_type) {
+      case BASE_TYPE_STRING:
+        return "_size += " + bound + "StringSizeUpperBound(" + value +
+               ".length());";
+      case BASE_TYPE_VECTOR: {
+        const auto vector_type = type.VectorType();
+        auto alignment = InlineAlignment(vector_type);
+        const auto *force_align = field.attributes.Lookup("force_align");
+        if (force_align) {
+          const auto align = atoi(force_align->constant.c_str());
+          alignment = (std::max)(alignment, static_cast<size_t>(align));
+        }
+        auto len = value + ".size()";
+        if (vector_type.base_type == BASE_TYPE_UTYPE) {
+          len = "_o." + StripUnionType(Name(field)) + ".size()";
+        }
+        auto code = "_size += " + bound + "VectorSizeUpperBound(" + len +
+                    ", " + NumToString(InlineSize(vector_type)) + ", " +
+                    NumToString(alignment) + ");";
+        if (IsString(vector_type)) {
+          code += "\n  for (const auto &_e : " + value + ") _size += " + bound +
+                  "StringSizeUpperBound(_e.length());";
+        } else if (vector_type.base_type == BASE_TYPE_STRUCT &&
+                   !IsStruct(vector_type)) {
+          code += "\n  for (const auto &_e : " + value +
+                  ") _size += GetPackedSizeUpperBound(*_e" + GenPtrGet(field) +
+                  ");";
+        } else if (vector_type.base_type == BASE_TYPE_UNION) {
+          code += "\n  for (const auto &_e : " + value +
+                  ") _size += _e.GetPackedSizeUpperBound();";
+        }
+        return code;
+      }
+      case BASE_TYPE_UNION:
+        return "_size += " + value + ".GetPackedSizeUpperBound();";
+      case BASE_TYPE_STRUCT:
+        if (IsStruct(type)) return "";
+        return "if (" + value + ") _size += GetPackedSizeUpperBound(*" +
+               value + GenPtrGet(field) + ");";
+      default: return "";
+    }
+  }
+
   // Generate code for tables that needs to come after the regular definition.
   void GenTablePost(const StructDef &struct_def) {
     code_.SetValue("STRUCT_NAME", Name(struct_def));
@@ -3010,9 +3350,43 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
-      // Generate the X::Pack member function that simply calls the global
-      // CreateX function.
+      // Generate GetPackedSizeUpperBound(), which adds up the largest size
+      // the table and its children can take up in the builder. The inline
+      // part of the table is known here already.
+      size_t inline_size = 0;
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        const auto &field = **it;
+        if (field.deprecated) { continue; }
+        const auto &type = field.value.type;
+        if (field.offset64) {
+          inline_size += 2 * sizeof(uoffset64_t) - 1;
+        } else {
+          inline_size += InlineSize(type) + InlineAlignment(type) - 1;
+        }
+      }
+      code_.SetValue("NUM_FIELDS", NumToString(struct_def.fields.vec.size()));
+      code_.SetValue("INLINE_SIZE", NumToString(inline_size));
+      code_ += "inline " + TablePackedSizeSignature(struct_def, opts_) + " {";
+      code_ += "  (void)_o;";
+      code_ +=
+          "  size_t _size = flatbuffers::FlatBufferBuilder::"
+          "TableSizeUpperBound({{NUM_FIELDS}}, {{INLINE_SIZE}});";
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        const auto &field = **it;
+        if (field.deprecated) { continue; }
+        const auto code = GenPackedSizeField(field);
+        if (!code.empty()) { code_ += "  " + code; }
+      }
+      code_ += "  return _size;";
+      code_ += "}";
+      code_ += "";
+
+      // Generate the X::Pack member function that reserves space for the
+      // whole object up front, and then calls the global CreateX function.
       code_ += "inline " + TablePackSignature(struct_def, false, opts_) + " {";
+      code_ += "  _fbb.Reserve(GetPackedSizeUpperBound(*_o));";
       code_ += "  return Create{{STRUCT_NAME}}(_fbb, _o, _rehasher);";
       code_ += "}";
       code_ += "";
@@ -3032,16 +3406,31 @@ class CppGenerator : public BaseGenerator {
           "const flatbuffers::rehasher_function_t *__rehasher; } _va = { "
           "&_fbb, _o, _rehasher}; (void)_va;";
 
-      for (auto it = struct_def.fields.vec.begin();
-           it != struct_def.fields.vec.end(); ++it) {
-        auto &field = **it;
-        if (field.deprecated) { continue; }
-        if (IsVector(field.value.type)) {
-          const std::string force_align_code =
-              GenVectorForceAlign(field, "_o->" + Name(field) + ".size()");
-          if (!force_align_code.empty()) { code_ += "  " + force_align_code; }
+      // Data referred to by 64-bit offsets has to be created first.
+      for (int pass = 0; pass < 2; pass++) {
+        for (auto it = struct_def.fields.vec.begin();
+             it != struct_def.fields.vec.end(); ++it) {
+          auto &field = **it;
+          if (field.deprecated || field.offset64 != (pass == 0)) { continue; }
+          if (IsVector(field.value.type)) {
+            const std::string force_align_code =
+                GenVectorForceAlign(field, "_o->" + Name(field) + ".size()");
+            if (!force_align_code.empty()) {
+              code_ += "  " + force_align_code;
+            }
+          }
+          // Hash indices are computed from the vector they index, whatever
+          // the object holds.
+          const auto indexed = HashIndexedField(struct_def, field);
+          if (indexed) {
+            code_ += "  auto _" + Name(field) + " = _" + Name(*indexed) +
+                     ".IsNull() ? 0 : _fbb.CreateKeyHashIndex(_" +
+                     Name(*indexed) + ");";
+            continue;
+          }
+          code_ +=
+              "  auto _" + Name(field) + " = " + GenCreateParam(field) + ";";
         }
-        code_ += "  auto _" + Name(field) + " = " + GenCreateParam(field) + ";";
       }
       // Need to call "Create" with the struct namespace.
       const auto qualified_create_name =
@@ -3303,6 +3692,20 @@ class CppGenerator : public BaseGenerator {
       code_ += "  }";
     }
 
+    // Generate the byte offsets of the fields, e.g. for StructColumn().
+    code_.SetValue("SEP", "");
+    code_ += "  enum FlatBuffersStructOffset {";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      code_.SetValue("OFFSET_NAME", GenStructFieldOffsetName(field));
+      code_.SetValue("OFFSET_VALUE", NumToString(field.value.offset));
+      code_ += "{{SEP}}    {{OFFSET_NAME}} = {{OFFSET_VALUE}}\\";
+      code_.SetValue("SEP", ",\n");
+    }
+    code_ += "";
+    code_ += "  };";
+
     GenFullyQualifiedNameGetter(struct_def, Name(struct_def));
 
     // Generate a default constructor.
@@ -273,6 +273,8 @@ struct JsonPrinter {
       auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
       auto root = GetRoot<Table>(vec->data());
       return GenStruct(*fd.nested_flatbuffer, root, indent);
+    } else if (fd.offset64) {
+      val = table->GetPointer64<const void *>(fd.value.offset);
     } else {
       val = IsStruct(fd.value.type)
                 ? table->GetStruct<const void *>(fd.value.offset)
@@ -979,6 +979,72 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
       return Error("flexbuffer attribute may only apply to a vector of ubyte");
   }
 
+  if (field->attributes.Lookup("offset64")) {
+    field->offset64 = true;
+    if (!SupportsOffset64())
+      return Error(
+          "offset64 is not yet supported in at least one of the specified "
+          "programming languages.");
+    if (struct_def.fixed) return Error("offset64 can't be used in structs");
+    // The data these refer to is placed at the end of the buffer, so it may
+    // not contain any 32-bit offsets itself. Vectors of structs are checked
+    // once the struct is known to be one.
+    if (!IsString(type) &&
+        !(IsVector(type) && (IsScalar(type.element) ||
+                             type.element == BASE_TYPE_STRUCT)))
+      return Error(
+          "offset64 may only apply to a string, or a vector of scalars or "
+          "structs");
+    if (field->key || field->shared || field->flexbuffer ||
+        field->nested_flatbuffer || field->attributes.Lookup("cpp_type"))
+      return Error(
+          "offset64 can't be combined with key, shared, flexbuffer, "
+          "nested_flatbuffer or cpp_type");
+  }
+
+  if (field->attributes.Lookup("eytzinger")) {
+    // Only generated C++ code knows how to search these, other languages
+    // would do a binary search as if the vector was sorted.
+    if (!SupportsEytzinger())
+      return Error(
+          "eytzinger is not yet supported in at least one of the specified "
+          "programming languages.");
+    if (struct_def.fixed) return Error("eytzinger can't be used in structs");
+    // Whether the elements have a key is checked once they're all known.
+    if (!IsVector(type) || type.element != BASE_TYPE_STRUCT || field->offset64)
+      return Error(
+          "eytzinger may only apply to a vector of tables or structs with a "
+          "key");
+  }
+
+  if (field->attributes.Lookup("hash_index")) {
+    if (struct_def.fixed) return Error("hash_index can't be used in structs");
+    // Whether the elements have a string key is checked once they're all
+    // known.
+    if (!IsVector(type) || type.element != BASE_TYPE_STRUCT ||
+        field->offset64 || field->attributes.Lookup("eytzinger"))
+      return Error(
+          "hash_index may only apply to a vector of tables with a string key, "
+          "and can't be combined with offset64 or eytzinger");
+    // The index is stored in a second auto-generated field after this one,
+    // with the next id if ids are assigned manually.
+    Type index_type(BASE_TYPE_VECTOR);
+    index_type.element = BASE_TYPE_UINT;
+    FieldDef *index_field;
+    ECHECK(AddField(struct_def, name + HashIndexFieldSuffix(), index_type,
+                    &index_field));
+    index_field->deprecated = field->deprecated;
+    auto attr = field->attributes.Lookup("id");
+    if (attr) {
+      voffset_t id = 0;
+      ECHECK(atot(attr->constant.c_str(), *this, &id));
+      auto val = new Value();
+      val->type = attr->type;
+      val->constant = NumToString(id + 1);
+      index_field->attributes.Add("id", val);
+    }
+  }
+
   if (typefield) {
     if (!IsScalar(typefield->value.type.base_type)) {
       // this is a union vector field
@@ -1237,7 +1303,10 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
             ECHECK(Next());  // Ignore this field.
           } else {
             Value val = field->value;
-            if (field->flexbuffer) {
+            if (field->offset64) {
+              return Error("offset64 fields can't be parsed from JSON: " +
+                           name);
+            } else if (field->flexbuffer) {
               flexbuffers::Builder builder(1024,
                                            flexbuffers::BUILDER_FLAG_SHARE_ALL);
               ECHECK(ParseFlexBufferValue(&builder));
@@ -1450,6 +1519,26 @@ static void SwapSerializedTables(Offset<Table> *a, Offset<Table> *b) {
   std::swap(*a, *b);
 }
 
+// Reorders a sorted vector into the layout of the `eytzinger` attribute.
+static void SerializedToEytzinger(VectorOfAny *v, size_t width,
+                                  bool offsets) {
+  const auto size = v->size();
+  const auto data = v->Data();
+  std::vector<uint8_t> sorted(data, data + size * width);
+  size_t i = 0;
+  for (auto k = EytzingerFirst(size); k; k = EytzingerNext(k, size), i++) {
+    auto dst = data + (k - 1) * width;
+    if (offsets) {
+      // These are relative to where they are stored, so adjust them by the
+      // distance moved.
+      auto o = ReadScalar<uoffset_t>(sorted.data() + i * width);
+      WriteScalar(dst, static_cast<uoffset_t>(o + i * width - (k - 1) * width));
+    } else {
+      memcpy(dst, sorted.data() + i * width, width);
+    }
+  }
+}
+
 // See below for why we need our own sort :(
 template<typename T, typename F, typename S>
 void SimpleQsort(T *begin, T *end, size_t width, F comparator, S swapper) {
@@ -1590,6 +1679,13 @@ CheckedError Parser::ParseVector(const Type &type, uoffset_t *ovalue,
             SwapSerializedTables);
       }
     }
+    if (field && field->attributes.Lookup("eytzinger")) {
+      SerializedToEytzinger(
+          reinterpret_cast<VectorOfAny *>(builder_.GetCurrentBufferPointer()),
+          type.struct_def->fixed ? type.struct_def->bytesize
+                                 : sizeof(Offset<Table>),
+          !type.struct_def->fixed);
+    }
   }
   return NoError();
 }
@@ -2438,6 +2534,18 @@ bool Parser::SupportsDefaultVectorsAndStrings() const {
   return !(opts.lang_to_generate & ~supported_langs);
 }
 
+bool Parser::SupportsOffset64() const {
+  static FLATBUFFERS_CONSTEXPR unsigned long supported_langs =
+      IDLOptions::kCpp | IDLOptions::kJson | IDLOptions::kBinary;
+  return !(opts.lang_to_generate & ~supported_langs);
+}
+
+bool Parser::SupportsEytzinger() const {
+  static FLATBUFFERS_CONSTEXPR unsigned long supported_langs =
+      IDLOptions::kCpp | IDLOptions::kJson | IDLOptions::kBinary;
+  return !(opts.lang_to_generate & ~supported_langs);
+}
+
 bool Parser::SupportsAdvancedUnionFeatures() const {
   return opts.lang_to_generate != 0 &&
          (opts.lang_to_generate &
@@ -3189,6 +3297,57 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
       }
     }
   }
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto &struct_def = **it;
+    for (auto field_it = struct_def.fields.vec.begin();
+         field_it != struct_def.fields.vec.end(); ++field_it) {
+      auto &field = **field_it;
+      auto elem_def = field.value.type.struct_def;
+      if (field.offset64 && elem_def &&
+          (!elem_def->fixed || elem_def->has_key ||
+           elem_def->attributes.Lookup("native_type")))
+        return Error(
+            "offset64 vectors may only hold structs without a key or "
+            "native_type: " +
+            field.name);
+      if (field.attributes.Lookup("eytzinger") &&
+          (!elem_def->has_key || elem_def->attributes.Lookup("native_type")))
+        return Error(
+            "eytzinger vectors may only hold tables or structs with a key, "
+            "and without native_type: " +
+            field.name);
+      if (field.attributes.Lookup("hash_index")) {
+        const FieldDef *key = nullptr;
+        for (auto key_it = elem_def->fields.vec.begin();
+             key_it != elem_def->fields.vec.end(); ++key_it) {
+          if ((*key_it)->key) key = *key_it;
+        }
+        if (elem_def->fixed || !key || !IsString(key->value.type))
+          return Error(
+              "hash_index vectors may only hold tables with a string key: " +
+              field.name);
+      }
+    }
+    // Generated code writes these tables in one go, with a vtable that is
+    // fixed at compile time, so every field must be present and inline.
+    if (struct_def.attributes.Lookup("precomputed_vtable")) {
+      if (struct_def.fixed)
+        return Error("precomputed_vtable can't be used on structs: " +
+                     struct_def.name);
+      for (auto field_it = struct_def.fields.vec.begin();
+           field_it != struct_def.fields.vec.end(); ++field_it) {
+        auto &field = **field_it;
+        if (field.deprecated) continue;
+        if (!(IsScalar(field.value.type.base_type) ||
+              IsStruct(field.value.type)) ||
+            field.IsScalarOptional())
+          return Error(
+              "precomputed_vtable tables may only have non-optional scalar, "
+              "enum or struct fields: " +
+              field.name);
+      }
+    }
+  }
   // Parse JSON object only if the scheme has been parsed.
   if (token_ == '{') { ECHECK(DoParseJson()); }
   EXPECT(kTokenEof);
@@ -3561,7 +3720,7 @@ Offset<reflection::Field> FieldDef::Serialize(FlatBufferBuilder *builder,
       IsInteger(value.type.base_type) ? StringToInt(value.constant.c_str()) : 0,
       // result may be platform-dependent if underlying is float (not double)
       IsFloat(value.type.base_type) ? d : 0.0, deprecated, IsRequired(), key,
-      attr__, docs__, IsOptional());
+      attr__, docs__, IsOptional(), offset64);
   // TODO: value.constant is almost always "0", we could save quite a bit of
   // space by sharing it. Same for common values of value.type.
 }
@@ -3578,6 +3737,7 @@ bool FieldDef::Deserialize(Parser &parser, const reflection::Field *field) {
   }
   presence = FieldDef::MakeFieldPresence(field->optional(), field->required());
   key = field->key();
+  offset64 = field->offset64();
   if (!DeserializeAttributes(parser, field->attributes())) return false;
   // TODO: this should probably be handled by a separate attribute
   if (attributes.Lookup("flexbuffer")) {
@@ -3896,6 +4056,8 @@ std::string Parser::ConformTo(const Parser &base) {
           return "defaults differ for field: " + field.name;
         if (!EqualByName(field.value.type, field_base->value.type))
           return "types differ for field: " + field.name;
+        if (field.offset64 != field_base->offset64)
+          return "offset sizes differ for field: " + field.name;
       } else {
         // Doesn't have to exist, deleting fields is fine.
         // But we should check if there is a field that has the same offset
@@ -252,6 +252,12 @@ class ResizeContext {
         // Get this fields' offset, and read it if safe.
         auto offsetloc = tableloc + offset;
         if (DagCheck(offsetloc)) continue;  // This offset already visited.
+        if (fielddef.offset64()) {
+          // A string or vector that holds no offsets itself.
+          auto ref64 = offsetloc + ReadScalar<uoffset64_t>(offsetloc);
+          Straddle<uoffset64_t, 1>(offsetloc, ref64, offsetloc);
+          continue;
+        }
         auto ref = offsetloc + ReadScalar<uoffset_t>(offsetloc);
         Straddle<uoffset_t, 1>(offsetloc, ref, offsetloc);
         // Recurse.
@@ -385,6 +391,9 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
     auto &fielddef = **it;
     // Skip if field is not present in the source.
     if (!table.CheckField(fielddef.offset())) continue;
+    // Data referred to by 64-bit offsets would have to be created before
+    // anything else in `fbb`, so such tables can't be copied.
+    if (fielddef.offset64()) return 0;
     uoffset_t offset = 0;
     switch (fielddef.type()->base_type()) {
       case reflection::String: {
@@ -399,6 +408,7 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
           offset = CopyTable(fbb, schema, subobjectdef,
                              *GetFieldT(table, fielddef), use_string_pooling)
                        .o;
+          if (!offset) return 0;
         }
         break;
       }
@@ -407,6 +417,7 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
         offset = CopyTable(fbb, schema, subobjectdef,
                            *GetFieldT(table, fielddef), use_string_pooling)
                      .o;
+        if (!offset) return 0;
         break;
       }
       case reflection::Vector: {
@@ -435,6 +446,7 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
               for (uoffset_t i = 0; i < vec->size(); i++) {
                 elements[i] = CopyTable(fbb, schema, *elemobjectdef,
                                         *vec->Get(i), use_string_pooling);
+                if (elements[i].IsNull()) return 0;
               }
               offset = fbb.CreateVector(elements).o;
               break;
@@ -552,6 +564,20 @@ bool VerifyVector(flatbuffers::Verifier &v, const reflection::Schema &schema,
                   const flatbuffers::Table &table,
                   const reflection::Field &vec_field) {
   FLATBUFFERS_ASSERT(vec_field.type()->base_type() == reflection::Vector);
+  if (vec_field.offset64()) {
+    // Only vectors of scalars and structs may have a 64-bit offset.
+    auto elem_type = vec_field.type()->element();
+    auto elem_size =
+        elem_type == reflection::Obj
+            ? static_cast<size_t>(
+                  schema.objects()->Get(vec_field.type()->index())->bytesize())
+            : GetTypeSize(elem_type);
+    auto vec = reinterpret_cast<const uint8_t *>(
+        flatbuffers::GetFieldAnyV(table, vec_field));
+    return table.VerifyOffset64(v, vec_field.offset()) &&
+           (!vec || v.VerifyVectorOrString(vec, elem_size, nullptr,
+                                           FLATBUFFERS_MAX_64_BUFFER_SIZE));
+  }
   if (!table.VerifyField<uoffset_t>(v, vec_field.offset())) return false;
 
   switch (vec_field.type()->element()) {
@@ -661,8 +687,14 @@ bool VerifyObject(flatbuffers::Verifier &v, const reflection::Schema &schema,
         if (!table->VerifyField<double>(v, field_def->offset())) return false;
         break;
       case reflection::String:
-        if (!table->VerifyField<uoffset_t>(v, field_def->offset()) ||
-            !v.VerifyString(flatbuffers::GetFieldS(*table, *field_def))) {
+        if (field_def->offset64()) {
+          if (!table->VerifyOffset64(v, field_def->offset()) ||
+              !v.VerifyString64(flatbuffers::GetFieldS(*table, *field_def))) {
+            return false;
+          }
+        } else if (!table->VerifyField<uoffset_t>(v, field_def->offset()) ||
+                   !v.VerifyString(
+                       flatbuffers::GetFieldS(*table, *field_def))) {
           return false;
         }
         break;
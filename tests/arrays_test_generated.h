@@ -75,6 +75,12 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) NestedStruct FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return NestedStructTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_A = 0,
+    OFFSET_B = 8,
+    OFFSET_C = 9,
+    OFFSET_D = 16
+  };
   NestedStruct()
       : a_(),
         b_(0),
@@ -160,6 +166,14 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) ArrayStruct FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return ArrayStructTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_A = 0,
+    OFFSET_B = 4,
+    OFFSET_C = 64,
+    OFFSET_D = 72,
+    OFFSET_E = 136,
+    OFFSET_F = 144
+  };
   ArrayStruct()
       : a_(0),
         b_(),
@@ -329,6 +343,7 @@ inline flatbuffers::Offset<ArrayTable> CreateArrayTable(
 }
 
 flatbuffers::Offset<ArrayTable> CreateArrayTable(flatbuffers::FlatBufferBuilder &_fbb, const ArrayTableT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const ArrayTableT &_o);
 
 inline ArrayTableT *ArrayTable::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<ArrayTableT>(new ArrayTableT());
@@ -342,7 +357,14 @@ inline void ArrayTable::UnPackTo(ArrayTableT *_o, const flatbuffers::resolver_fu
   { auto _e = a(); if (_e) _o->a = flatbuffers::unique_ptr<MyGame::Example::ArrayStruct>(new MyGame::Example::ArrayStruct(*_e)); }
 }
 
+inline size_t GetPackedSizeUpperBound(const ArrayTableT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 167);
+  return _size;
+}
+
 inline flatbuffers::Offset<ArrayTable> ArrayTable::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ArrayTableT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateArrayTable(_fbb, _o, _rehasher);
 }
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Tests of reading unverified buffers with FLATBUFFERS_CHECKED_ACCESS, which
+// changes all accessors, so flattests is built without it.
+
+#include "flatbuffers/flatbuffers.h"
+#include "monster_test_generated.h"
+#include "test_assert.h"
+
+using namespace MyGame::Example;
+
+void CheckedAccessTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto name = fbb.CreateString("root");
+  std::vector<std::string> strings = { "a", "b" };
+  auto strings_vec = fbb.CreateVectorOfStrings(strings);
+  auto inventory = fbb.CreateVector(std::vector<uint8_t>(100, 1));
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_testarrayofstring(strings_vec);
+  mb.add_inventory(inventory);
+  mb.add_hp(80);
+  FinishMonsterBuffer(fbb, mb.Finish());
+  std::vector<uint8_t> buf(fbb.GetBufferPointer(),
+                           fbb.GetBufferPointer() + fbb.GetSize());
+  {
+    flatbuffers::CheckedAccess access(buf.data(), buf.size());
+    auto monster = access.GetRoot<Monster>();
+    TEST_NOTNULL(monster);
+    TEST_EQ(monster->hp(), 80);
+    TEST_EQ_STR(monster->name()->c_str(), "root");
+    TEST_EQ_STR(monster->testarrayofstring()->Get(1)->c_str(), "b");
+    TEST_EQ(monster->inventory()->size(), 100U);
+    TEST_EQ(access.ok(), true);
+  }
+
+  // The name is built first, so ends the buffer. Without its last bytes it
+  // reads as absent, and the rest is still fine.
+  auto monster = GetMonster(buf.data());
+  auto name_end = reinterpret_cast<const uint8_t *>(monster->name()) -
+                  buf.data() + 4;
+  {
+    flatbuffers::CheckedAccess access(buf.data(), name_end);
+    TEST_EQ(access.ok(), true);
+    auto truncated = access.GetRoot<Monster>();
+    TEST_NOTNULL(truncated);
+    TEST_EQ(truncated->inventory()->size(), 100U);
+    TEST_EQ(access.ok(), true);
+    TEST_EQ(truncated->name() == nullptr, true);
+    TEST_EQ(access.ok(), false);
+    TEST_EQ(truncated->hp(), 80);
+  }
+
+  // Offsets pointing outside of the buffer, and misaligned fields.
+  auto strings_data = const_cast<uint8_t *>(
+      reinterpret_cast<const uint8_t *>(monster->testarrayofstring()->Data()));
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(strings_data + 4,
+                                                    0x7FFFFFF0);
+  auto vtable =
+      reinterpret_cast<const flatbuffers::Table *>(monster)->GetVTable();
+  auto &hp_field = buf[static_cast<size_t>(vtable - buf.data()) +
+                       Monster::VT_HP];
+  flatbuffers::WriteScalar<flatbuffers::voffset_t>(
+      &hp_field,
+      flatbuffers::ReadScalar<flatbuffers::voffset_t>(&hp_field) + 1);
+  {
+    flatbuffers::CheckedAccess access(buf.data(), buf.size());
+    auto corrupt = access.GetRoot<Monster>();
+    TEST_EQ_STR(corrupt->testarrayofstring()->Get(0)->c_str(), "a");
+    TEST_EQ(access.ok(), true);
+    TEST_EQ(corrupt->testarrayofstring()->Get(1) == nullptr, true);
+    TEST_EQ(access.ok(), false);
+    TEST_EQ(corrupt->hp(), 100);
+  }
+
+  // Looking up a key in a sorted vector with an element out of the buffer.
+  flatbuffers::FlatBufferBuilder keyed_fbb;
+  std::vector<flatbuffers::Offset<Monster>> keyed;
+  for (int i = 0; i < 8; i++) {
+    keyed.push_back(CreateMonster(
+        keyed_fbb, nullptr, 0, 0,
+        keyed_fbb.CreateString("m" + flatbuffers::NumToString(i))));
+  }
+  auto keyed_vec = keyed_fbb.CreateVectorOfSortedTables(&keyed);
+  auto keyed_name = keyed_fbb.CreateString("root");
+  MonsterBuilder keyed_root(keyed_fbb);
+  keyed_root.add_name(keyed_name);
+  keyed_root.add_testarrayoftables(keyed_vec);
+  FinishMonsterBuffer(keyed_fbb, keyed_root.Finish());
+  std::vector<uint8_t> keyed_buf(
+      keyed_fbb.GetBufferPointer(),
+      keyed_fbb.GetBufferPointer() + keyed_fbb.GetSize());
+  auto tables = GetMonster(keyed_buf.data())->testarrayoftables();
+  TEST_NOTNULL(tables->LookupByKey("m3"));
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(
+      const_cast<uint8_t *>(tables->Data()) + 3 * 4, 0x40000000);
+  {
+    flatbuffers::CheckedAccess access(keyed_buf.data(), keyed_buf.size());
+    auto corrupt = access.GetRoot<Monster>();
+    TEST_EQ(corrupt->testarrayoftables()->LookupByKey("m3") == nullptr,
+            true);
+    TEST_EQ(access.ok(), false);
+  }
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  InitTestEngine();
+
+  CheckedAccessTest();
+
+  if (!testing_fails) {
+    TEST_OUTPUT_LINE("CheckedAccess: ALL TESTS PASSED");
+  } else {
+    TEST_OUTPUT_LINE("CheckedAccess: %d FAILED TESTS", testing_fails);
+  }
+  return CloseTestEngine();
+}
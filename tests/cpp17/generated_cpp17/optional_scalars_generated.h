@@ -683,6 +683,7 @@ struct ScalarStuff::Traits {
 };
 
 flatbuffers::Offset<ScalarStuff> CreateScalarStuff(flatbuffers::FlatBufferBuilder &_fbb, const ScalarStuffT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const ScalarStuffT &_o);
 
 inline ScalarStuffT *ScalarStuff::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::make_unique<ScalarStuffT>();
@@ -731,7 +732,14 @@ inline void ScalarStuff::UnPackTo(ScalarStuffT *_o, const flatbuffers::resolver_
   { auto _e = default_enum(); _o->default_enum = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const ScalarStuffT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(36, 228);
+  return _size;
+}
+
 inline flatbuffers::Offset<ScalarStuff> ScalarStuff::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ScalarStuffT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateScalarStuff(_fbb, _o, _rehasher);
 }
 
@@ -121,6 +121,10 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) Struct FLATBUFFERS_FINAL_CLASS {
   double b_;
 
  public:
+  enum FlatBuffersStructOffset {
+    OFFSET_A = 0,
+    OFFSET_B = 8
+  };
   Struct()
       : a_(0),
         padding0__(0),
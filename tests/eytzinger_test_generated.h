@@ -0,0 +1,488 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_EYTZINGERTEST_EYTZINGER_TEST_H_
+#define FLATBUFFERS_GENERATED_EYTZINGERTEST_EYTZINGER_TEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace eytzinger_test {
+
+struct Point;
+
+struct Entry;
+struct EntryBuilder;
+struct EntryT;
+
+struct Index;
+struct IndexBuilder;
+struct IndexT;
+
+bool operator==(const Point &lhs, const Point &rhs);
+bool operator!=(const Point &lhs, const Point &rhs);
+bool operator==(const EntryT &lhs, const EntryT &rhs);
+bool operator!=(const EntryT &lhs, const EntryT &rhs);
+bool operator==(const IndexT &lhs, const IndexT &rhs);
+bool operator!=(const IndexT &lhs, const IndexT &rhs);
+
+inline const flatbuffers::TypeTable *PointTypeTable();
+
+inline const flatbuffers::TypeTable *EntryTypeTable();
+
+inline const flatbuffers::TypeTable *IndexTypeTable();
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t id_;
+  float x_;
+  float y_;
+
+ public:
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return PointTypeTable();
+  }
+  enum FlatBuffersStructOffset {
+    OFFSET_ID = 0,
+    OFFSET_X = 4,
+    OFFSET_Y = 8
+  };
+  Point()
+      : id_(0),
+        x_(0),
+        y_(0) {
+  }
+  Point(uint32_t _id, float _x, float _y)
+      : id_(flatbuffers::EndianScalar(_id)),
+        x_(flatbuffers::EndianScalar(_x)),
+        y_(flatbuffers::EndianScalar(_y)) {
+  }
+  uint32_t id() const {
+    return flatbuffers::EndianScalar(id_);
+  }
+  void mutate_id(uint32_t _id) {
+    flatbuffers::WriteScalar(&id_, _id);
+  }
+  bool KeyCompareLessThan(const Point *o) const {
+    return id() < o->id();
+  }
+  int KeyCompareWithValue(uint32_t val) const {
+    return static_cast<int>(id() > val) - static_cast<int>(id() < val);
+  }
+  uint32_t GetKey() const {
+    return id();
+  }
+  float x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  void mutate_x(float _x) {
+    flatbuffers::WriteScalar(&x_, _x);
+  }
+  float y() const {
+    return flatbuffers::EndianScalar(y_);
+  }
+  void mutate_y(float _y) {
+    flatbuffers::WriteScalar(&y_, _y);
+  }
+};
+FLATBUFFERS_STRUCT_END(Point, 12);
+
+inline bool operator==(const Point &lhs, const Point &rhs) {
+  return
+      (lhs.id() == rhs.id()) &&
+      (lhs.x() == rhs.x()) &&
+      (lhs.y() == rhs.y());
+}
+
+inline bool operator!=(const Point &lhs, const Point &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct EntryT : public flatbuffers::NativeTable {
+  typedef Entry TableType;
+  std::string name{};
+  int32_t value = 0;
+};
+
+inline bool operator==(const EntryT &lhs, const EntryT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.value == rhs.value);
+}
+
+inline bool operator!=(const EntryT &lhs, const EntryT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Entry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EntryT NativeTableType;
+  typedef EntryBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EntryTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_VALUE = 6
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  bool KeyCompareLessThan(const Entry *o) const {
+    return *name() < *o->name();
+  }
+  int KeyCompareWithValue(const char *val) const {
+    return strcmp(name()->c_str(), val);
+  }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
+  int32_t value() const {
+    return GetField<int32_t>(VT_VALUE, 0);
+  }
+  bool mutate_value(int32_t _value) {
+    return SetField<int32_t>(VT_VALUE, _value, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<int32_t>(verifier, VT_VALUE) &&
+           verifier.EndTable();
+  }
+  EntryT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EntryT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Entry> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EntryBuilder {
+  typedef Entry Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Entry::VT_NAME, name);
+  }
+  void add_value(int32_t value) {
+    fbb_.AddElement<int32_t>(Entry::VT_VALUE, value, 0);
+  }
+  explicit EntryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Entry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Entry>(end);
+    fbb_.Required(o, Entry::VT_NAME);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Entry> CreateEntry(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    int32_t value = 0) {
+  EntryBuilder builder_(_fbb);
+  builder_.add_value(value);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Entry> CreateEntryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    int32_t value = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return eytzinger_test::CreateEntry(
+      _fbb,
+      name__,
+      value);
+}
+
+flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const EntryT &_o);
+
+struct IndexT : public flatbuffers::NativeTable {
+  typedef Index TableType;
+  std::vector<flatbuffers::unique_ptr<eytzinger_test::EntryT>> entries{};
+  std::vector<eytzinger_test::Point> points{};
+};
+
+inline bool operator==(const IndexT &lhs, const IndexT &rhs) {
+  return
+      (lhs.entries == rhs.entries) &&
+      (lhs.points == rhs.points);
+}
+
+inline bool operator!=(const IndexT &lhs, const IndexT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Index FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef IndexT NativeTableType;
+  typedef IndexBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return IndexTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENTRIES = 4,
+    VT_POINTS = 6
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<eytzinger_test::Entry>> *entries() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<eytzinger_test::Entry>> *>(VT_ENTRIES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<eytzinger_test::Entry>> *mutable_entries() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<eytzinger_test::Entry>> *>(VT_ENTRIES);
+  }
+  flatbuffers::EytzingerVector<flatbuffers::Offset<eytzinger_test::Entry>> entries_by_key() const {
+    return flatbuffers::EytzingerVector<flatbuffers::Offset<eytzinger_test::Entry>>(entries());
+  }
+  const flatbuffers::Vector<const eytzinger_test::Point *> *points() const {
+    return GetPointer<const flatbuffers::Vector<const eytzinger_test::Point *> *>(VT_POINTS);
+  }
+  flatbuffers::Vector<const eytzinger_test::Point *> *mutable_points() {
+    return GetPointer<flatbuffers::Vector<const eytzinger_test::Point *> *>(VT_POINTS);
+  }
+  flatbuffers::EytzingerVector<const eytzinger_test::Point *> points_by_key() const {
+    return flatbuffers::EytzingerVector<const eytzinger_test::Point *>(points());
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           VerifyOffset(verifier, VT_POINTS) &&
+           verifier.VerifyVector(points()) &&
+           verifier.EndTable();
+  }
+  IndexT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(IndexT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Index> Pack(flatbuffers::FlatBufferBuilder &_fbb, const IndexT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct IndexBuilder {
+  typedef Index Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_entries(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<eytzinger_test::Entry>>> entries) {
+    fbb_.AddOffset(Index::VT_ENTRIES, entries);
+  }
+  void add_points(flatbuffers::Offset<flatbuffers::Vector<const eytzinger_test::Point *>> points) {
+    fbb_.AddOffset(Index::VT_POINTS, points);
+  }
+  explicit IndexBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Index> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Index>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Index> CreateIndex(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<eytzinger_test::Entry>>> entries = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const eytzinger_test::Point *>> points = 0) {
+  IndexBuilder builder_(_fbb);
+  builder_.add_points(points);
+  builder_.add_entries(entries);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Index> CreateIndexDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    std::vector<flatbuffers::Offset<eytzinger_test::Entry>> *entries = nullptr,
+    std::vector<eytzinger_test::Point> *points = nullptr) {
+  auto entries__ = entries ? _fbb.CreateVectorOfEytzingerTables<eytzinger_test::Entry>(*entries) : 0;
+  auto points__ = points ? _fbb.CreateVectorOfEytzingerStructs<eytzinger_test::Point>(*points) : 0;
+  return eytzinger_test::CreateIndex(
+      _fbb,
+      entries__,
+      points__);
+}
+
+flatbuffers::Offset<Index> CreateIndex(flatbuffers::FlatBufferBuilder &_fbb, const IndexT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const IndexT &_o);
+
+inline EntryT *Entry::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<EntryT>(new EntryT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Entry::UnPackTo(EntryT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name = _e->str(); }
+  { auto _e = value(); _o->value = _e; }
+}
+
+inline size_t GetPackedSizeUpperBound(const EntryT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(2, 14);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.name.length());
+  return _size;
+}
+
+inline flatbuffers::Offset<Entry> Entry::Pack(flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateEntry(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const EntryT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _fbb.CreateString(_o->name);
+  auto _value = _o->value;
+  return eytzinger_test::CreateEntry(
+      _fbb,
+      _name,
+      _value);
+}
+
+inline IndexT *Index::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<IndexT>(new IndexT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Index::UnPackTo(IndexT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = entries(); if (_e) { _o->entries.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->entries[_i] = flatbuffers::unique_ptr<eytzinger_test::EntryT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = points(); if (_e) { _o->points.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->points[_i] = *_e->Get(_i); } } }
+}
+
+inline size_t GetPackedSizeUpperBound(const IndexT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(2, 14);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.entries.size(), 4, 4);
+  for (const auto &_e : _o.entries) _size += GetPackedSizeUpperBound(*_e.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.points.size(), 12, 4);
+  return _size;
+}
+
+inline flatbuffers::Offset<Index> Index::Pack(flatbuffers::FlatBufferBuilder &_fbb, const IndexT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateIndex(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Index> CreateIndex(flatbuffers::FlatBufferBuilder &_fbb, const IndexT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const IndexT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _entries = _o->entries.size() ? _fbb.CreateVectorOfEytzingerTables<eytzinger_test::Entry> (_o->entries.size(), [](size_t i, _VectorArgs *__va) { return CreateEntry(*__va->__fbb, __va->__o->entries[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _points = _o->points.size() ? _fbb.CreateVectorOfEytzingerStructs(_o->points) : 0;
+  return eytzinger_test::CreateIndex(
+      _fbb,
+      _entries,
+      _points);
+}
+
+inline const flatbuffers::TypeTable *PointTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_UINT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const int64_t values[] = { 0, 4, 8, 12 };
+  static const char * const names[] = {
+    "id",
+    "x",
+    "y"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_STRUCT, 3, type_codes, nullptr, nullptr, values, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *EntryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_INT, 0, -1 }
+  };
+  static const char * const names[] = {
+    "name",
+    "value"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *IndexTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    eytzinger_test::EntryTypeTable,
+    eytzinger_test::PointTypeTable
+  };
+  static const char * const names[] = {
+    "entries",
+    "points"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const eytzinger_test::Index *GetIndex(const void *buf) {
+  return flatbuffers::GetRoot<eytzinger_test::Index>(buf);
+}
+
+inline const eytzinger_test::Index *GetSizePrefixedIndex(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<eytzinger_test::Index>(buf);
+}
+
+inline Index *GetMutableIndex(void *buf) {
+  return flatbuffers::GetMutableRoot<Index>(buf);
+}
+
+inline bool VerifyIndexBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<eytzinger_test::Index>(nullptr);
+}
+
+inline bool VerifySizePrefixedIndexBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<eytzinger_test::Index>(nullptr);
+}
+
+inline void FinishIndexBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<eytzinger_test::Index> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedIndexBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<eytzinger_test::Index> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<eytzinger_test::IndexT> UnPackIndex(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<eytzinger_test::IndexT>(GetIndex(buf)->UnPack(res));
+}
+
+inline flatbuffers::unique_ptr<eytzinger_test::IndexT> UnPackSizePrefixedIndex(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<eytzinger_test::IndexT>(GetSizePrefixedIndex(buf)->UnPack(res));
+}
+
+}  // namespace eytzinger_test
+
+#endif  // FLATBUFFERS_GENERATED_EYTZINGERTEST_EYTZINGER_TEST_H_
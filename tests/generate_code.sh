@@ -61,6 +61,18 @@ $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS $TEST_CS_FLAGS $TEST_JS_TS_FLAGS -o namespace
 ../flatc --csharp --rust --gen-object-api optional_scalars.fbs
 ../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp optional_scalars.fbs
 
+# Generate 64-bit offset code for tests.
+../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp offset64_test.fbs
+
+# Generate precomputed vtable code for tests.
+../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp precomputed_vtable_test.fbs
+
+# Generate Eytzinger layout code for tests.
+../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp eytzinger_test.fbs
+
+# Generate hash index code for tests.
+../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp hash_index_test.fbs
+
 # Generate string/vector default code for tests
 ../flatc --rust --gen-object-api more_defaults.fbs
 
@@ -0,0 +1,419 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_HASHINDEXTEST_HASH_INDEX_TEST_H_
+#define FLATBUFFERS_GENERATED_HASHINDEXTEST_HASH_INDEX_TEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace hash_index_test {
+
+struct Entry;
+struct EntryBuilder;
+struct EntryT;
+
+struct Dictionary;
+struct DictionaryBuilder;
+struct DictionaryT;
+
+bool operator==(const EntryT &lhs, const EntryT &rhs);
+bool operator!=(const EntryT &lhs, const EntryT &rhs);
+bool operator==(const DictionaryT &lhs, const DictionaryT &rhs);
+bool operator!=(const DictionaryT &lhs, const DictionaryT &rhs);
+
+inline const flatbuffers::TypeTable *EntryTypeTable();
+
+inline const flatbuffers::TypeTable *DictionaryTypeTable();
+
+struct EntryT : public flatbuffers::NativeTable {
+  typedef Entry TableType;
+  std::string name{};
+  int32_t value = 0;
+};
+
+inline bool operator==(const EntryT &lhs, const EntryT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.value == rhs.value);
+}
+
+inline bool operator!=(const EntryT &lhs, const EntryT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Entry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EntryT NativeTableType;
+  typedef EntryBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EntryTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_VALUE = 6
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  bool KeyCompareLessThan(const Entry *o) const {
+    return *name() < *o->name();
+  }
+  int KeyCompareWithValue(const char *val) const {
+    return strcmp(name()->c_str(), val);
+  }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
+  int32_t value() const {
+    return GetField<int32_t>(VT_VALUE, 0);
+  }
+  bool mutate_value(int32_t _value) {
+    return SetField<int32_t>(VT_VALUE, _value, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<int32_t>(verifier, VT_VALUE) &&
+           verifier.EndTable();
+  }
+  EntryT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EntryT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Entry> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EntryBuilder {
+  typedef Entry Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Entry::VT_NAME, name);
+  }
+  void add_value(int32_t value) {
+    fbb_.AddElement<int32_t>(Entry::VT_VALUE, value, 0);
+  }
+  explicit EntryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Entry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Entry>(end);
+    fbb_.Required(o, Entry::VT_NAME);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Entry> CreateEntry(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    int32_t value = 0) {
+  EntryBuilder builder_(_fbb);
+  builder_.add_value(value);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Entry> CreateEntryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    int32_t value = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return hash_index_test::CreateEntry(
+      _fbb,
+      name__,
+      value);
+}
+
+flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const EntryT &_o);
+
+struct DictionaryT : public flatbuffers::NativeTable {
+  typedef Dictionary TableType;
+  std::vector<flatbuffers::unique_ptr<hash_index_test::EntryT>> entries{};
+  std::vector<uint32_t> entries_hash_index{};
+  std::vector<flatbuffers::unique_ptr<hash_index_test::EntryT>> unindexed{};
+};
+
+inline bool operator==(const DictionaryT &lhs, const DictionaryT &rhs) {
+  return
+      (lhs.entries == rhs.entries) &&
+      (lhs.entries_hash_index == rhs.entries_hash_index) &&
+      (lhs.unindexed == rhs.unindexed);
+}
+
+inline bool operator!=(const DictionaryT &lhs, const DictionaryT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Dictionary FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef DictionaryT NativeTableType;
+  typedef DictionaryBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return DictionaryTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENTRIES = 4,
+    VT_ENTRIES_HASH_INDEX = 6,
+    VT_UNINDEXED = 8
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *entries() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *>(VT_ENTRIES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *mutable_entries() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *>(VT_ENTRIES);
+  }
+  const hash_index_test::Entry *entries_by_key_hashed(const char *key) const {
+    return flatbuffers::LookupByKeyHashed(entries(), entries_hash_index(), key);
+  }
+  const flatbuffers::Vector<uint32_t> *entries_hash_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_ENTRIES_HASH_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_entries_hash_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_ENTRIES_HASH_INDEX);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *unindexed() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *>(VT_UNINDEXED);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *mutable_unindexed() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>> *>(VT_UNINDEXED);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           VerifyOffset(verifier, VT_ENTRIES_HASH_INDEX) &&
+           verifier.VerifyVector(entries_hash_index()) &&
+           VerifyOffset(verifier, VT_UNINDEXED) &&
+           verifier.VerifyVector(unindexed()) &&
+           verifier.VerifyVectorOfTables(unindexed()) &&
+           verifier.EndTable();
+  }
+  DictionaryT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(DictionaryT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Dictionary> Pack(flatbuffers::FlatBufferBuilder &_fbb, const DictionaryT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct DictionaryBuilder {
+  typedef Dictionary Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_entries(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>>> entries) {
+    fbb_.AddOffset(Dictionary::VT_ENTRIES, entries);
+  }
+  void add_entries_hash_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> entries_hash_index) {
+    fbb_.AddOffset(Dictionary::VT_ENTRIES_HASH_INDEX, entries_hash_index);
+  }
+  void add_unindexed(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>>> unindexed) {
+    fbb_.AddOffset(Dictionary::VT_UNINDEXED, unindexed);
+  }
+  explicit DictionaryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Dictionary> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Dictionary>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Dictionary> CreateDictionary(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>>> entries = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> entries_hash_index = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<hash_index_test::Entry>>> unindexed = 0) {
+  DictionaryBuilder builder_(_fbb);
+  builder_.add_unindexed(unindexed);
+  builder_.add_entries_hash_index(entries_hash_index);
+  builder_.add_entries(entries);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Dictionary> CreateDictionaryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    std::vector<flatbuffers::Offset<hash_index_test::Entry>> *entries = nullptr,
+    std::vector<flatbuffers::Offset<hash_index_test::Entry>> *unindexed = nullptr) {
+  auto entries__ = entries ? _fbb.CreateVectorOfSortedTables<hash_index_test::Entry>(entries) : 0;
+  auto entries_hash_index__ = entries ? _fbb.CreateKeyHashIndex(entries__) : 0;
+  auto unindexed__ = unindexed ? _fbb.CreateVectorOfSortedTables<hash_index_test::Entry>(unindexed) : 0;
+  return hash_index_test::CreateDictionary(
+      _fbb,
+      entries__,
+      entries_hash_index__,
+      unindexed__);
+}
+
+flatbuffers::Offset<Dictionary> CreateDictionary(flatbuffers::FlatBufferBuilder &_fbb, const DictionaryT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const DictionaryT &_o);
+
+inline EntryT *Entry::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<EntryT>(new EntryT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Entry::UnPackTo(EntryT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name = _e->str(); }
+  { auto _e = value(); _o->value = _e; }
+}
+
+inline size_t GetPackedSizeUpperBound(const EntryT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(2, 14);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.name.length());
+  return _size;
+}
+
+inline flatbuffers::Offset<Entry> Entry::Pack(flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateEntry(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const EntryT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _fbb.CreateString(_o->name);
+  auto _value = _o->value;
+  return hash_index_test::CreateEntry(
+      _fbb,
+      _name,
+      _value);
+}
+
+inline DictionaryT *Dictionary::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<DictionaryT>(new DictionaryT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Dictionary::UnPackTo(DictionaryT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = entries(); if (_e) { _o->entries.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->entries[_i] = flatbuffers::unique_ptr<hash_index_test::EntryT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = entries_hash_index(); if (_e) { _o->entries_hash_index.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->entries_hash_index[_i] = _e->Get(_i); } } }
+  { auto _e = unindexed(); if (_e) { _o->unindexed.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->unindexed[_i] = flatbuffers::unique_ptr<hash_index_test::EntryT>(_e->Get(_i)->UnPack(_resolver)); } } }
+}
+
+inline size_t GetPackedSizeUpperBound(const DictionaryT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(3, 21);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.entries.size(), 4, 4);
+  for (const auto &_e : _o.entries) _size += GetPackedSizeUpperBound(*_e.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.entries_hash_index.size(), 4, 4);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.unindexed.size(), 4, 4);
+  for (const auto &_e : _o.unindexed) _size += GetPackedSizeUpperBound(*_e.get());
+  return _size;
+}
+
+inline flatbuffers::Offset<Dictionary> Dictionary::Pack(flatbuffers::FlatBufferBuilder &_fbb, const DictionaryT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateDictionary(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Dictionary> CreateDictionary(flatbuffers::FlatBufferBuilder &_fbb, const DictionaryT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const DictionaryT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _entries = _o->entries.size() ? _fbb.CreateVector<flatbuffers::Offset<hash_index_test::Entry>> (_o->entries.size(), [](size_t i, _VectorArgs *__va) { return CreateEntry(*__va->__fbb, __va->__o->entries[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _entries_hash_index = _entries.IsNull() ? 0 : _fbb.CreateKeyHashIndex(_entries);
+  auto _unindexed = _o->unindexed.size() ? _fbb.CreateVector<flatbuffers::Offset<hash_index_test::Entry>> (_o->unindexed.size(), [](size_t i, _VectorArgs *__va) { return CreateEntry(*__va->__fbb, __va->__o->unindexed[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return hash_index_test::CreateDictionary(
+      _fbb,
+      _entries,
+      _entries_hash_index,
+      _unindexed);
+}
+
+inline const flatbuffers::TypeTable *EntryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_INT, 0, -1 }
+  };
+  static const char * const names[] = {
+    "name",
+    "value"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *DictionaryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_UINT, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    hash_index_test::EntryTypeTable
+  };
+  static const char * const names[] = {
+    "entries",
+    "entries_hash_index",
+    "unindexed"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 3, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const hash_index_test::Dictionary *GetDictionary(const void *buf) {
+  return flatbuffers::GetRoot<hash_index_test::Dictionary>(buf);
+}
+
+inline const hash_index_test::Dictionary *GetSizePrefixedDictionary(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<hash_index_test::Dictionary>(buf);
+}
+
+inline Dictionary *GetMutableDictionary(void *buf) {
+  return flatbuffers::GetMutableRoot<Dictionary>(buf);
+}
+
+inline bool VerifyDictionaryBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<hash_index_test::Dictionary>(nullptr);
+}
+
+inline bool VerifySizePrefixedDictionaryBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<hash_index_test::Dictionary>(nullptr);
+}
+
+inline void FinishDictionaryBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<hash_index_test::Dictionary> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedDictionaryBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<hash_index_test::Dictionary> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<hash_index_test::DictionaryT> UnPackDictionary(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<hash_index_test::DictionaryT>(GetDictionary(buf)->UnPack(res));
+}
+
+inline flatbuffers::unique_ptr<hash_index_test::DictionaryT> UnPackSizePrefixedDictionary(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<hash_index_test::DictionaryT>(GetSizePrefixedDictionary(buf)->UnPack(res));
+}
+
+}  // namespace hash_index_test
+
+#endif  // FLATBUFFERS_GENERATED_HASHINDEXTEST_HASH_INDEX_TEST_H_
@@ -249,6 +249,7 @@ inline flatbuffers::Offset<MonsterExtra> CreateMonsterExtraDirect(
 }
 
 flatbuffers::Offset<MonsterExtra> CreateMonsterExtra(flatbuffers::FlatBufferBuilder &_fbb, const MonsterExtraT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterExtraT &_o);
 
 inline MonsterExtraT *MonsterExtra::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<MonsterExtraT>(new MonsterExtraT());
@@ -271,7 +272,16 @@ inline void MonsterExtra::UnPackTo(MonsterExtraT *_o, const flatbuffers::resolve
   { auto _e = fvec(); if (_e) { _o->fvec.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->fvec[_i] = _e->Get(_i); } } }
 }
 
+inline size_t GetPackedSizeUpperBound(const MonsterExtraT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(11, 102);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.dvec.size(), 8, 8);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.fvec.size(), 4, 4);
+  return _size;
+}
+
 inline flatbuffers::Offset<MonsterExtra> MonsterExtra::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterExtraT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateMonsterExtra(_fbb, _o, _rehasher);
 }
 
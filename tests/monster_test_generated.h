@@ -267,6 +267,7 @@ struct AnyUnion {
 
   static void *UnPack(const void *obj, Any type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
 
   MyGame::Example::MonsterT *AsMonster() {
     return type == Any_Monster ?
@@ -409,6 +410,7 @@ struct AnyUniqueAliasesUnion {
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
 
   MyGame::Example::MonsterT *AsM() {
     return type == AnyUniqueAliases_M ?
@@ -523,6 +525,7 @@ struct AnyAmbiguousAliasesUnion {
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
 
   MyGame::Example::MonsterT *AsM1() {
     return type == AnyAmbiguousAliases_M1 ?
@@ -592,6 +595,10 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(2) Test FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return TestTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_A = 0,
+    OFFSET_B = 2
+  };
   Test()
       : a_(0),
         b_(0),
@@ -646,6 +653,14 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) Vec3 FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return Vec3TypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_X = 0,
+    OFFSET_Y = 4,
+    OFFSET_Z = 8,
+    OFFSET_TEST1 = 16,
+    OFFSET_TEST2 = 24,
+    OFFSET_TEST3 = 26
+  };
   Vec3()
       : x_(0),
         y_(0),
@@ -737,6 +752,10 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return AbilityTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_ID = 0,
+    OFFSET_DISTANCE = 4
+  };
   Ability()
       : id_(0),
         distance_(0) {
@@ -757,6 +776,9 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
   int KeyCompareWithValue(uint32_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint32_t GetKey() const {
+    return id();
+  }
   uint32_t distance() const {
     return flatbuffers::EndianScalar(distance_);
   }
@@ -829,6 +851,7 @@ inline flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(
 }
 
 flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const InParentNamespaceT &_o);
 
 namespace Example2 {
 
@@ -882,6 +905,7 @@ inline flatbuffers::Offset<Monster> CreateMonster(
 }
 
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterT &_o);
 
 }  // namespace Example2
 
@@ -954,6 +978,7 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
 }
 
 flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TestSimpleTableWithEnumT &_o);
 
 struct StatT : public flatbuffers::NativeTable {
   typedef Stat TableType;
@@ -1009,6 +1034,9 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint16_t val) const {
     return static_cast<int>(count() > val) - static_cast<int>(count() < val);
   }
+  uint16_t GetKey() const {
+    return count();
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ID) &&
@@ -1072,6 +1100,7 @@ inline flatbuffers::Offset<Stat> CreateStatDirect(
 }
 
 flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb, const StatT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const StatT &_o);
 
 struct ReferrableT : public flatbuffers::NativeTable {
   typedef Referrable TableType;
@@ -1109,6 +1138,9 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint64_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint64_t GetKey() const {
+    return id();
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint64_t>(verifier, VT_ID) &&
@@ -1146,6 +1178,7 @@ inline flatbuffers::Offset<Referrable> CreateReferrable(
 }
 
 flatbuffers::Offset<Referrable> CreateReferrable(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const ReferrableT &_o);
 
 struct MonsterT : public flatbuffers::NativeTable {
   typedef Monster TableType;
@@ -1343,6 +1376,9 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const flatbuffers::Vector<uint8_t> *inventory() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
@@ -2166,6 +2202,7 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(
 }
 
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterT &_o);
 
 struct TypeAliasesT : public flatbuffers::NativeTable {
   typedef TypeAliases TableType;
@@ -2433,6 +2470,7 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliasesDirect(
 }
 
 flatbuffers::Offset<TypeAliases> CreateTypeAliases(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TypeAliasesT &_o);
 
 }  // namespace Example
 
@@ -2447,7 +2485,14 @@ inline void InParentNamespace::UnPackTo(InParentNamespaceT *_o, const flatbuffer
   (void)_resolver;
 }
 
+inline size_t GetPackedSizeUpperBound(const InParentNamespaceT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(0, 0);
+  return _size;
+}
+
 inline flatbuffers::Offset<InParentNamespace> InParentNamespace::Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateInParentNamespace(_fbb, _o, _rehasher);
 }
 
@@ -2472,7 +2517,14 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
   (void)_resolver;
 }
 
+inline size_t GetPackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(0, 0);
+  return _size;
+}
+
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
@@ -2500,7 +2552,14 @@ inline void TestSimpleTableWithEnum::UnPackTo(TestSimpleTableWithEnumT *_o, cons
   { auto _e = color(); _o->color = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const TestSimpleTableWithEnumT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 1);
+  return _size;
+}
+
 inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnum::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateTestSimpleTableWithEnum(_fbb, _o, _rehasher);
 }
 
@@ -2528,7 +2587,15 @@ inline void Stat::UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_r
   { auto _e = count(); _o->count = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const StatT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(3, 25);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.id.length());
+  return _size;
+}
+
 inline flatbuffers::Offset<Stat> Stat::Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateStat(_fbb, _o, _rehasher);
 }
 
@@ -2558,7 +2625,14 @@ inline void Referrable::UnPackTo(ReferrableT *_o, const flatbuffers::resolver_fu
   { auto _e = id(); _o->id = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const ReferrableT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 15);
+  return _size;
+}
+
 inline flatbuffers::Offset<Referrable> Referrable::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateReferrable(_fbb, _o, _rehasher);
 }
 
@@ -2640,7 +2714,47 @@ if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_
   { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->scalar_key_sorted_tables[_i] = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } }
 }
 
+inline size_t GetPackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(51, 394);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.name.length());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.inventory.size(), 1, 1);
+  _size += _o.test.GetPackedSizeUpperBound();
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.test4.size(), 4, 2);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testarrayofstring.size(), 4, 4);
+  for (const auto &_e : _o.testarrayofstring) _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_e.length());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testarrayoftables.size(), 4, 4);
+  for (const auto &_e : _o.testarrayoftables) _size += GetPackedSizeUpperBound(*_e.get());
+  if (_o.enemy) _size += GetPackedSizeUpperBound(*_o.enemy.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testnestedflatbuffer.size(), 1, 1);
+  if (_o.testempty) _size += GetPackedSizeUpperBound(*_o.testempty.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testarrayofbools.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testarrayofstring2.size(), 4, 4);
+  for (const auto &_e : _o.testarrayofstring2) _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_e.length());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testarrayofsortedstruct.size(), 8, 4);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.flex.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.test5.size(), 4, 2);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_longs.size(), 8, 8);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_doubles.size(), 8, 8);
+  if (_o.parent_namespace_test) _size += GetPackedSizeUpperBound(*_o.parent_namespace_test.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_referrables.size(), 4, 4);
+  for (const auto &_e : _o.vector_of_referrables) _size += GetPackedSizeUpperBound(*_e.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_weak_references.size(), 8, 8);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_strong_referrables.size(), 4, 4);
+  for (const auto &_e : _o.vector_of_strong_referrables) _size += GetPackedSizeUpperBound(*_e.get());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_co_owning_references.size(), 8, 8);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_non_owning_references.size(), 8, 8);
+  _size += _o.any_unique.GetPackedSizeUpperBound();
+  _size += _o.any_ambiguous.GetPackedSizeUpperBound();
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vector_of_enums.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.testrequirednestedflatbuffer.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.scalar_key_sorted_tables.size(), 4, 4);
+  for (const auto &_e : _o.scalar_key_sorted_tables) _size += GetPackedSizeUpperBound(*_e.get());
+  return _size;
+}
+
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
@@ -2775,7 +2889,16 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_
   { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } }
 }
 
+inline size_t GetPackedSizeUpperBound(const TypeAliasesT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(12, 88);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.v8.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vf64.size(), 8, 8);
+  return _size;
+}
+
 inline flatbuffers::Offset<TypeAliases> TypeAliases::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateTypeAliases(_fbb, _o, _rehasher);
 }
 
@@ -2880,6 +3003,24 @@ inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &
   }
 }
 
+inline size_t AnyUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case Any_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case Any_TestSimpleTableWithEnum: {
+      auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case Any_MyGame_Example2_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ::MyGame::Example2::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUnion::AnyUnion(const AnyUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Any_Monster: {
@@ -2991,6 +3132,24 @@ inline flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(flatbuffers::FlatBu
   }
 }
 
+inline size_t AnyUniqueAliasesUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyUniqueAliases_TS: {
+      auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyUniqueAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ::MyGame::Example2::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUniqueAliasesUnion::AnyUniqueAliasesUnion(const AnyUniqueAliasesUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -3102,6 +3261,24 @@ inline flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(flatbuffers::Fla
   }
 }
 
+inline size_t AnyAmbiguousAliasesUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyAmbiguousAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyAmbiguousAliases_M3: {
+      auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline AnyAmbiguousAliasesUnion::AnyAmbiguousAliasesUnion(const AnyAmbiguousAliasesUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
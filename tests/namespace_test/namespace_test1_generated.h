@@ -93,6 +93,7 @@ struct UnionInNestedNSUnion {
 
   static void *UnPack(const void *obj, UnionInNestedNS type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
 
   NamespaceA::NamespaceB::TableInNestedNST *AsTableInNestedNS() {
     return type == UnionInNestedNS_TableInNestedNS ?
@@ -170,6 +171,10 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) StructInNestedNS FLATBUFFERS_FINAL_CLASS
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return StructInNestedNSTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_A = 0,
+    OFFSET_B = 4
+  };
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
     return "NamespaceA.NamespaceB.StructInNestedNS";
   }
@@ -280,6 +285,7 @@ inline flatbuffers::Offset<TableInNestedNS> CreateTableInNestedNS(
 }
 
 flatbuffers::Offset<TableInNestedNS> CreateTableInNestedNS(flatbuffers::FlatBufferBuilder &_fbb, const TableInNestedNST *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TableInNestedNST &_o);
 
 inline TableInNestedNST *TableInNestedNS::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<TableInNestedNST>(new TableInNestedNST());
@@ -293,7 +299,14 @@ inline void TableInNestedNS::UnPackTo(TableInNestedNST *_o, const flatbuffers::r
   { auto _e = foo(); _o->foo = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const TableInNestedNST &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 7);
+  return _size;
+}
+
 inline flatbuffers::Offset<TableInNestedNS> TableInNestedNS::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TableInNestedNST* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateTableInNestedNS(_fbb, _o, _rehasher);
 }
 
@@ -352,6 +365,16 @@ inline flatbuffers::Offset<void> UnionInNestedNSUnion::Pack(flatbuffers::FlatBuf
   }
 }
 
+inline size_t UnionInNestedNSUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case UnionInNestedNS_TableInNestedNS: {
+      auto ptr = reinterpret_cast<const NamespaceA::NamespaceB::TableInNestedNST *>(value);
+      return ::NamespaceA::NamespaceB::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
 inline UnionInNestedNSUnion::UnionInNestedNSUnion(const UnionInNestedNSUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case UnionInNestedNS_TableInNestedNS: {
@@ -195,6 +195,7 @@ inline flatbuffers::Offset<TableInFirstNS> CreateTableInFirstNS(
 }
 
 flatbuffers::Offset<TableInFirstNS> CreateTableInFirstNS(flatbuffers::FlatBufferBuilder &_fbb, const TableInFirstNST *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TableInFirstNST &_o);
 
 }  // namespace NamespaceA
 
@@ -290,6 +291,7 @@ inline flatbuffers::Offset<TableInC> CreateTableInC(
 }
 
 flatbuffers::Offset<TableInC> CreateTableInC(flatbuffers::FlatBufferBuilder &_fbb, const TableInCT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TableInCT &_o);
 
 }  // namespace NamespaceC
 
@@ -369,6 +371,7 @@ inline flatbuffers::Offset<SecondTableInA> CreateSecondTableInA(
 }
 
 flatbuffers::Offset<SecondTableInA> CreateSecondTableInA(flatbuffers::FlatBufferBuilder &_fbb, const SecondTableInAT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const SecondTableInAT &_o);
 
 inline TableInFirstNST *TableInFirstNS::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<TableInFirstNST>(new TableInFirstNST());
@@ -386,7 +389,16 @@ inline void TableInFirstNS::UnPackTo(TableInFirstNST *_o, const flatbuffers::res
   { auto _e = foo_struct(); if (_e) _o->foo_struct = flatbuffers::unique_ptr<NamespaceA::NamespaceB::StructInNestedNS>(new NamespaceA::NamespaceB::StructInNestedNS(*_e)); }
 }
 
+inline size_t GetPackedSizeUpperBound(const TableInFirstNST &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(5, 27);
+  if (_o.foo_table) _size += GetPackedSizeUpperBound(*_o.foo_table.get());
+  _size += _o.foo_union.GetPackedSizeUpperBound();
+  return _size;
+}
+
 inline flatbuffers::Offset<TableInFirstNS> TableInFirstNS::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TableInFirstNST* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateTableInFirstNS(_fbb, _o, _rehasher);
 }
 
@@ -425,7 +437,16 @@ inline void TableInC::UnPackTo(TableInCT *_o, const flatbuffers::resolver_functi
   { auto _e = refer_to_a2(); if (_e) _o->refer_to_a2 = flatbuffers::unique_ptr<NamespaceA::SecondTableInAT>(_e->UnPack(_resolver)); }
 }
 
+inline size_t GetPackedSizeUpperBound(const TableInCT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(2, 14);
+  if (_o.refer_to_a1) _size += GetPackedSizeUpperBound(*_o.refer_to_a1.get());
+  if (_o.refer_to_a2) _size += GetPackedSizeUpperBound(*_o.refer_to_a2.get());
+  return _size;
+}
+
 inline flatbuffers::Offset<TableInC> TableInC::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TableInCT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateTableInC(_fbb, _o, _rehasher);
 }
 
@@ -457,7 +478,15 @@ inline void SecondTableInA::UnPackTo(SecondTableInAT *_o, const flatbuffers::res
   { auto _e = refer_to_c(); if (_e) _o->refer_to_c = flatbuffers::unique_ptr<NamespaceC::TableInCT>(_e->UnPack(_resolver)); }
 }
 
+inline size_t GetPackedSizeUpperBound(const SecondTableInAT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 7);
+  if (_o.refer_to_c) _size += GetPackedSizeUpperBound(*_o.refer_to_c.get());
+  return _size;
+}
+
 inline flatbuffers::Offset<SecondTableInA> SecondTableInA::Pack(flatbuffers::FlatBufferBuilder &_fbb, const SecondTableInAT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateSecondTableInA(_fbb, _o, _rehasher);
 }
 
@@ -30,6 +30,11 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vector3D FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return Vector3DTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_X = 0,
+    OFFSET_Y = 4,
+    OFFSET_Z = 8
+  };
   Vector3D()
       : x_(0),
         y_(0),
@@ -128,6 +133,7 @@ inline flatbuffers::Offset<ApplicationData> CreateApplicationDataDirect(
 }
 
 flatbuffers::Offset<ApplicationData> CreateApplicationData(flatbuffers::FlatBufferBuilder &_fbb, const ApplicationDataT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const ApplicationDataT &_o);
 
 inline ApplicationDataT *ApplicationData::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<ApplicationDataT>(new ApplicationDataT());
@@ -141,7 +147,15 @@ inline void ApplicationData::UnPackTo(ApplicationDataT *_o, const flatbuffers::r
   { auto _e = vectors(); if (_e) { _o->vectors.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vectors[_i] = flatbuffers::UnPack(*_e->Get(_i)); } } }
 }
 
+inline size_t GetPackedSizeUpperBound(const ApplicationDataT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 7);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.vectors.size(), 12, 4);
+  return _size;
+}
+
 inline flatbuffers::Offset<ApplicationData> ApplicationData::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ApplicationDataT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateApplicationData(_fbb, _o, _rehasher);
 }
 
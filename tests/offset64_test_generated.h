@@ -0,0 +1,482 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_OFFSET64TEST_OFFSET64_TEST_H_
+#define FLATBUFFERS_GENERATED_OFFSET64TEST_OFFSET64_TEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace offset64_test {
+
+struct Point;
+
+struct Cloud;
+struct CloudBuilder;
+struct CloudT;
+
+bool operator==(const Point &lhs, const Point &rhs);
+bool operator!=(const Point &lhs, const Point &rhs);
+bool operator==(const CloudT &lhs, const CloudT &rhs);
+bool operator!=(const CloudT &lhs, const CloudT &rhs);
+
+inline const flatbuffers::TypeTable *PointTypeTable();
+
+inline const flatbuffers::TypeTable *CloudTypeTable();
+
+enum Kind : uint8_t {
+  Kind_Small = 0,
+  Kind_Large = 1,
+  Kind_MIN = Kind_Small,
+  Kind_MAX = Kind_Large
+};
+
+inline const Kind (&EnumValuesKind())[2] {
+  static const Kind values[] = {
+    Kind_Small,
+    Kind_Large
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesKind() {
+  static const char * const names[3] = {
+    "Small",
+    "Large",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameKind(Kind e) {
+  if (flatbuffers::IsOutRange(e, Kind_Small, Kind_Large)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesKind()[index];
+}
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return PointTypeTable();
+  }
+  enum FlatBuffersStructOffset {
+    OFFSET_X = 0,
+    OFFSET_Y = 4,
+    OFFSET_Z = 8
+  };
+  Point()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Point(float _x, float _y, float _z)
+      : x_(flatbuffers::EndianScalar(_x)),
+        y_(flatbuffers::EndianScalar(_y)),
+        z_(flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  void mutate_x(float _x) {
+    flatbuffers::WriteScalar(&x_, _x);
+  }
+  float y() const {
+    return flatbuffers::EndianScalar(y_);
+  }
+  void mutate_y(float _y) {
+    flatbuffers::WriteScalar(&y_, _y);
+  }
+  float z() const {
+    return flatbuffers::EndianScalar(z_);
+  }
+  void mutate_z(float _z) {
+    flatbuffers::WriteScalar(&z_, _z);
+  }
+};
+FLATBUFFERS_STRUCT_END(Point, 12);
+
+inline bool operator==(const Point &lhs, const Point &rhs) {
+  return
+      (lhs.x() == rhs.x()) &&
+      (lhs.y() == rhs.y()) &&
+      (lhs.z() == rhs.z());
+}
+
+inline bool operator!=(const Point &lhs, const Point &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct CloudT : public flatbuffers::NativeTable {
+  typedef Cloud TableType;
+  std::string name{};
+  std::vector<offset64_test::Point> points{};
+  std::vector<float> samples{};
+  std::string label{};
+  std::vector<offset64_test::Kind> kinds{};
+  std::vector<bool> flags{};
+  std::vector<std::string> tags{};
+};
+
+inline bool operator==(const CloudT &lhs, const CloudT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.points == rhs.points) &&
+      (lhs.samples == rhs.samples) &&
+      (lhs.label == rhs.label) &&
+      (lhs.kinds == rhs.kinds) &&
+      (lhs.flags == rhs.flags) &&
+      (lhs.tags == rhs.tags);
+}
+
+inline bool operator!=(const CloudT &lhs, const CloudT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Cloud FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef CloudT NativeTableType;
+  typedef CloudBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return CloudTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_POINTS = 6,
+    VT_SAMPLES = 8,
+    VT_LABEL = 10,
+    VT_KINDS = 12,
+    VT_FLAGS = 14,
+    VT_TAGS = 16
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::Vector<const offset64_test::Point *> *points() const {
+    return GetPointer64<const flatbuffers::Vector<const offset64_test::Point *> *>(VT_POINTS);
+  }
+  flatbuffers::Vector<const offset64_test::Point *> *mutable_points() {
+    return GetPointer64<flatbuffers::Vector<const offset64_test::Point *> *>(VT_POINTS);
+  }
+  const flatbuffers::Vector<float> *samples() const {
+    return GetPointer64<const flatbuffers::Vector<float> *>(VT_SAMPLES);
+  }
+  flatbuffers::Vector<float> *mutable_samples() {
+    return GetPointer64<flatbuffers::Vector<float> *>(VT_SAMPLES);
+  }
+  const flatbuffers::String *label() const {
+    return GetPointer64<const flatbuffers::String *>(VT_LABEL);
+  }
+  flatbuffers::String *mutable_label() {
+    return GetPointer64<flatbuffers::String *>(VT_LABEL);
+  }
+  const flatbuffers::Vector<uint8_t> *kinds() const {
+    return GetPointer64<const flatbuffers::Vector<uint8_t> *>(VT_KINDS);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_kinds() {
+    return GetPointer64<flatbuffers::Vector<uint8_t> *>(VT_KINDS);
+  }
+  const flatbuffers::Vector<uint8_t> *flags() const {
+    return GetPointer64<const flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_flags() {
+    return GetPointer64<flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_tags() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset64(verifier, VT_POINTS) &&
+           verifier.VerifyVector64(points()) &&
+           VerifyOffset64(verifier, VT_SAMPLES) &&
+           verifier.VerifyVector64(samples()) &&
+           VerifyOffset64(verifier, VT_LABEL) &&
+           verifier.VerifyString64(label()) &&
+           VerifyOffset64(verifier, VT_KINDS) &&
+           verifier.VerifyVector64(kinds()) &&
+           VerifyOffset64(verifier, VT_FLAGS) &&
+           verifier.VerifyVector64(flags()) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           verifier.EndTable();
+  }
+  CloudT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(CloudT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Cloud> Pack(flatbuffers::FlatBufferBuilder &_fbb, const CloudT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct CloudBuilder {
+  typedef Cloud Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Cloud::VT_NAME, name);
+  }
+  void add_points(flatbuffers::Offset64<flatbuffers::Vector<const offset64_test::Point *>> points) {
+    fbb_.AddOffset(Cloud::VT_POINTS, points);
+  }
+  void add_samples(flatbuffers::Offset64<flatbuffers::Vector<float>> samples) {
+    fbb_.AddOffset(Cloud::VT_SAMPLES, samples);
+  }
+  void add_label(flatbuffers::Offset64<flatbuffers::String> label) {
+    fbb_.AddOffset(Cloud::VT_LABEL, label);
+  }
+  void add_kinds(flatbuffers::Offset64<flatbuffers::Vector<uint8_t>> kinds) {
+    fbb_.AddOffset(Cloud::VT_KINDS, kinds);
+  }
+  void add_flags(flatbuffers::Offset64<flatbuffers::Vector<uint8_t>> flags) {
+    fbb_.AddOffset(Cloud::VT_FLAGS, flags);
+  }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Cloud::VT_TAGS, tags);
+  }
+  explicit CloudBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Cloud> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Cloud>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Cloud> CreateCloud(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset64<flatbuffers::Vector<const offset64_test::Point *>> points = 0,
+    flatbuffers::Offset64<flatbuffers::Vector<float>> samples = 0,
+    flatbuffers::Offset64<flatbuffers::String> label = 0,
+    flatbuffers::Offset64<flatbuffers::Vector<uint8_t>> kinds = 0,
+    flatbuffers::Offset64<flatbuffers::Vector<uint8_t>> flags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0) {
+  CloudBuilder builder_(_fbb);
+  builder_.add_flags(flags);
+  builder_.add_kinds(kinds);
+  builder_.add_label(label);
+  builder_.add_samples(samples);
+  builder_.add_points(points);
+  builder_.add_tags(tags);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Cloud> CreateCloudDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<offset64_test::Point> *points = nullptr,
+    const std::vector<float> *samples = nullptr,
+    const char *label = nullptr,
+    const std::vector<uint8_t> *kinds = nullptr,
+    const std::vector<uint8_t> *flags = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr) {
+  auto points__ = points ? _fbb.CreateVectorOfStructs64<offset64_test::Point>(*points) : 0;
+  if (samples) { _fbb.ForceVectorAlignment64(samples->size(), sizeof(float), 16); }
+  auto samples__ = samples ? _fbb.CreateVector64<float>(*samples) : 0;
+  auto label__ = label ? _fbb.CreateString64(label) : 0;
+  auto kinds__ = kinds ? _fbb.CreateVector64<uint8_t>(*kinds) : 0;
+  auto flags__ = flags ? _fbb.CreateVector64<uint8_t>(*flags) : 0;
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto tags__ = tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0;
+  return offset64_test::CreateCloud(
+      _fbb,
+      name__,
+      points__,
+      samples__,
+      label__,
+      kinds__,
+      flags__,
+      tags__);
+}
+
+flatbuffers::Offset<Cloud> CreateCloud(flatbuffers::FlatBufferBuilder &_fbb, const CloudT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const CloudT &_o);
+
+inline CloudT *Cloud::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<CloudT>(new CloudT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Cloud::UnPackTo(CloudT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name = _e->str(); }
+  { auto _e = points(); if (_e) { _o->points.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->points[_i] = *_e->Get(_i); } } }
+  { auto _e = samples(); if (_e) { _o->samples.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->samples[_i] = _e->Get(_i); } } }
+  { auto _e = label(); if (_e) _o->label = _e->str(); }
+  { auto _e = kinds(); if (_e) { _o->kinds.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->kinds[_i] = static_cast<offset64_test::Kind>(_e->Get(_i)); } } }
+  { auto _e = flags(); if (_e) { _o->flags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flags[_i] = _e->Get(_i) != 0; } } }
+  { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->tags[_i] = _e->Get(_i)->str(); } } }
+}
+
+inline size_t GetPackedSizeUpperBound(const CloudT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(7, 89);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.name.length());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.points.size(), 12, 4);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.samples.size(), 4, 16);
+  _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_o.label.length());
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.kinds.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.flags.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.tags.size(), 4, 4);
+  for (const auto &_e : _o.tags) _size += flatbuffers::FlatBufferBuilder::StringSizeUpperBound(_e.length());
+  return _size;
+}
+
+inline flatbuffers::Offset<Cloud> Cloud::Pack(flatbuffers::FlatBufferBuilder &_fbb, const CloudT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateCloud(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Cloud> CreateCloud(flatbuffers::FlatBufferBuilder &_fbb, const CloudT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const CloudT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _points = _o->points.size() ? _fbb.CreateVectorOfStructs64(_o->points) : 0;
+  _fbb.ForceVectorAlignment64(_o->samples.size(), sizeof(float), 16);
+  auto _samples = _o->samples.size() ? _fbb.CreateVector64(_o->samples) : 0;
+  auto _label = _o->label.empty() ? 0 : _fbb.CreateString64(_o->label);
+  auto _kinds = _o->kinds.size() ? _fbb.CreateVectorScalarCast64<uint8_t>(flatbuffers::data(_o->kinds), _o->kinds.size()) : 0;
+  auto _flags = _o->flags.size() ? _fbb.CreateVector64(_o->flags) : 0;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _tags = _o->tags.size() ? _fbb.CreateVectorOfStrings(_o->tags) : 0;
+  return offset64_test::CreateCloud(
+      _fbb,
+      _name,
+      _points,
+      _samples,
+      _label,
+      _kinds,
+      _flags,
+      _tags);
+}
+
+inline const flatbuffers::TypeTable *KindTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    offset64_test::KindTypeTable
+  };
+  static const char * const names[] = {
+    "Small",
+    "Large"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_ENUM, 2, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PointTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const int64_t values[] = { 0, 4, 8, 12 };
+  static const char * const names[] = {
+    "x",
+    "y",
+    "z"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_STRUCT, 3, type_codes, nullptr, nullptr, values, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *CloudTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_FLOAT, 1, -1 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_UCHAR, 1, 1 },
+    { flatbuffers::ET_BOOL, 1, -1 },
+    { flatbuffers::ET_STRING, 1, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    offset64_test::PointTypeTable,
+    offset64_test::KindTypeTable
+  };
+  static const char * const names[] = {
+    "name",
+    "points",
+    "samples",
+    "label",
+    "kinds",
+    "flags",
+    "tags"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 7, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const offset64_test::Cloud *GetCloud(const void *buf) {
+  return flatbuffers::GetRoot<offset64_test::Cloud>(buf);
+}
+
+inline const offset64_test::Cloud *GetSizePrefixedCloud(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<offset64_test::Cloud>(buf);
+}
+
+inline Cloud *GetMutableCloud(void *buf) {
+  return flatbuffers::GetMutableRoot<Cloud>(buf);
+}
+
+inline bool VerifyCloudBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<offset64_test::Cloud>(nullptr);
+}
+
+inline bool VerifySizePrefixedCloudBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<offset64_test::Cloud>(nullptr);
+}
+
+inline void FinishCloudBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<offset64_test::Cloud> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedCloudBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<offset64_test::Cloud> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<offset64_test::CloudT> UnPackCloud(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<offset64_test::CloudT>(GetCloud(buf)->UnPack(res));
+}
+
+inline flatbuffers::unique_ptr<offset64_test::CloudT> UnPackSizePrefixedCloud(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<offset64_test::CloudT>(GetSizePrefixedCloud(buf)->UnPack(res));
+}
+
+}  // namespace offset64_test
+
+#endif  // FLATBUFFERS_GENERATED_OFFSET64TEST_OFFSET64_TEST_H_
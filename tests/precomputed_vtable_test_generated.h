@@ -0,0 +1,584 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_PRECOMPUTEDVTABLETEST_PRECOMPUTED_VTABLE_TEST_H_
+#define FLATBUFFERS_GENERATED_PRECOMPUTEDVTABLETEST_PRECOMPUTED_VTABLE_TEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace precomputed_vtable_test {
+
+struct Vec3;
+
+struct Sample;
+struct SampleBuilder;
+struct SampleT;
+
+struct Log;
+struct LogBuilder;
+struct LogT;
+
+bool operator==(const Vec3 &lhs, const Vec3 &rhs);
+bool operator!=(const Vec3 &lhs, const Vec3 &rhs);
+bool operator==(const SampleT &lhs, const SampleT &rhs);
+bool operator!=(const SampleT &lhs, const SampleT &rhs);
+bool operator==(const LogT &lhs, const LogT &rhs);
+bool operator!=(const LogT &lhs, const LogT &rhs);
+
+inline const flatbuffers::TypeTable *Vec3TypeTable();
+
+inline const flatbuffers::TypeTable *SampleTypeTable();
+
+inline const flatbuffers::TypeTable *LogTypeTable();
+
+enum Status : uint8_t {
+  Status_Ok = 0,
+  Status_Degraded = 1,
+  Status_Failed = 2,
+  Status_MIN = Status_Ok,
+  Status_MAX = Status_Failed
+};
+
+inline const Status (&EnumValuesStatus())[3] {
+  static const Status values[] = {
+    Status_Ok,
+    Status_Degraded,
+    Status_Failed
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesStatus() {
+  static const char * const names[4] = {
+    "Ok",
+    "Degraded",
+    "Failed",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameStatus(Status e) {
+  if (flatbuffers::IsOutRange(e, Status_Ok, Status_Failed)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesStatus()[index];
+}
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3 FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return Vec3TypeTable();
+  }
+  enum FlatBuffersStructOffset {
+    OFFSET_X = 0,
+    OFFSET_Y = 4,
+    OFFSET_Z = 8
+  };
+  Vec3()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Vec3(float _x, float _y, float _z)
+      : x_(flatbuffers::EndianScalar(_x)),
+        y_(flatbuffers::EndianScalar(_y)),
+        z_(flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  void mutate_x(float _x) {
+    flatbuffers::WriteScalar(&x_, _x);
+  }
+  float y() const {
+    return flatbuffers::EndianScalar(y_);
+  }
+  void mutate_y(float _y) {
+    flatbuffers::WriteScalar(&y_, _y);
+  }
+  float z() const {
+    return flatbuffers::EndianScalar(z_);
+  }
+  void mutate_z(float _z) {
+    flatbuffers::WriteScalar(&z_, _z);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vec3, 12);
+
+inline bool operator==(const Vec3 &lhs, const Vec3 &rhs) {
+  return
+      (lhs.x() == rhs.x()) &&
+      (lhs.y() == rhs.y()) &&
+      (lhs.z() == rhs.z());
+}
+
+inline bool operator!=(const Vec3 &lhs, const Vec3 &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct SampleT : public flatbuffers::NativeTable {
+  typedef Sample TableType;
+  uint64_t timestamp = 0;
+  uint16_t sensor = 0;
+  flatbuffers::unique_ptr<precomputed_vtable_test::Vec3> position{};
+  float temperature = 0.0f;
+  precomputed_vtable_test::Status status = precomputed_vtable_test::Status_Ok;
+  bool valid = true;
+  float pressure = 101.3f;
+};
+
+inline bool operator==(const SampleT &lhs, const SampleT &rhs) {
+  return
+      (lhs.timestamp == rhs.timestamp) &&
+      (lhs.sensor == rhs.sensor) &&
+      (lhs.position == rhs.position) &&
+      (lhs.temperature == rhs.temperature) &&
+      (lhs.status == rhs.status) &&
+      (lhs.valid == rhs.valid) &&
+      (lhs.pressure == rhs.pressure);
+}
+
+inline bool operator!=(const SampleT &lhs, const SampleT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Sample FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef SampleT NativeTableType;
+  typedef SampleBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return SampleTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TIMESTAMP = 4,
+    VT_SENSOR = 6,
+    VT_POSITION = 10,
+    VT_TEMPERATURE = 12,
+    VT_STATUS = 14,
+    VT_VALID = 16,
+    VT_PRESSURE = 18
+  };
+  uint64_t timestamp() const {
+    return GetField<uint64_t>(VT_TIMESTAMP, 0);
+  }
+  bool mutate_timestamp(uint64_t _timestamp) {
+    return SetField<uint64_t>(VT_TIMESTAMP, _timestamp, 0);
+  }
+  uint16_t sensor() const {
+    return GetField<uint16_t>(VT_SENSOR, 0);
+  }
+  bool mutate_sensor(uint16_t _sensor) {
+    return SetField<uint16_t>(VT_SENSOR, _sensor, 0);
+  }
+  const precomputed_vtable_test::Vec3 *position() const {
+    return GetStruct<const precomputed_vtable_test::Vec3 *>(VT_POSITION);
+  }
+  precomputed_vtable_test::Vec3 *mutable_position() {
+    return GetStruct<precomputed_vtable_test::Vec3 *>(VT_POSITION);
+  }
+  float temperature() const {
+    return GetField<float>(VT_TEMPERATURE, 0.0f);
+  }
+  bool mutate_temperature(float _temperature) {
+    return SetField<float>(VT_TEMPERATURE, _temperature, 0.0f);
+  }
+  precomputed_vtable_test::Status status() const {
+    return static_cast<precomputed_vtable_test::Status>(GetField<uint8_t>(VT_STATUS, 0));
+  }
+  bool mutate_status(precomputed_vtable_test::Status _status) {
+    return SetField<uint8_t>(VT_STATUS, static_cast<uint8_t>(_status), 0);
+  }
+  bool valid() const {
+    return GetField<uint8_t>(VT_VALID, 1) != 0;
+  }
+  bool mutate_valid(bool _valid) {
+    return SetField<uint8_t>(VT_VALID, static_cast<uint8_t>(_valid), 1);
+  }
+  float pressure() const {
+    return GetField<float>(VT_PRESSURE, 101.3f);
+  }
+  bool mutate_pressure(float _pressure) {
+    return SetField<float>(VT_PRESSURE, _pressure, 101.3f);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_TIMESTAMP) &&
+           VerifyField<uint16_t>(verifier, VT_SENSOR) &&
+           VerifyField<precomputed_vtable_test::Vec3>(verifier, VT_POSITION) &&
+           VerifyField<float>(verifier, VT_TEMPERATURE) &&
+           VerifyField<uint8_t>(verifier, VT_STATUS) &&
+           VerifyField<uint8_t>(verifier, VT_VALID) &&
+           VerifyField<float>(verifier, VT_PRESSURE) &&
+           verifier.EndTable();
+  }
+  SampleT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(SampleT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Sample> Pack(flatbuffers::FlatBufferBuilder &_fbb, const SampleT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct SampleBuilder {
+  typedef Sample Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_timestamp(uint64_t timestamp) {
+    fbb_.AddElement<uint64_t>(Sample::VT_TIMESTAMP, timestamp, 0);
+  }
+  void add_sensor(uint16_t sensor) {
+    fbb_.AddElement<uint16_t>(Sample::VT_SENSOR, sensor, 0);
+  }
+  void add_position(const precomputed_vtable_test::Vec3 *position) {
+    fbb_.AddStruct(Sample::VT_POSITION, position);
+  }
+  void add_temperature(float temperature) {
+    fbb_.AddElement<float>(Sample::VT_TEMPERATURE, temperature, 0.0f);
+  }
+  void add_status(precomputed_vtable_test::Status status) {
+    fbb_.AddElement<uint8_t>(Sample::VT_STATUS, static_cast<uint8_t>(status), 0);
+  }
+  void add_valid(bool valid) {
+    fbb_.AddElement<uint8_t>(Sample::VT_VALID, static_cast<uint8_t>(valid), 1);
+  }
+  void add_pressure(float pressure) {
+    fbb_.AddElement<float>(Sample::VT_PRESSURE, pressure, 101.3f);
+  }
+  explicit SampleBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Sample> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Sample>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Sample> CreateSample(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t timestamp = 0,
+    uint16_t sensor = 0,
+    const precomputed_vtable_test::Vec3 *position = 0,
+    float temperature = 0.0f,
+    precomputed_vtable_test::Status status = precomputed_vtable_test::Status_Ok,
+    bool valid = true,
+    float pressure = 101.3f) {
+  static FLATBUFFERS_CONSTEXPR flatbuffers::voffset_t vtable[] = { 20, 36, 28, 6, 0, 8, 20, 4, 5, 24 };
+  auto _p = _fbb.StartFixedTable(36, 8);
+  flatbuffers::WriteScalar<uint64_t>(_p + 28, timestamp);
+  flatbuffers::WriteScalar<float>(_p + 24, pressure);
+  flatbuffers::WriteScalar<float>(_p + 20, temperature);
+  _fbb.SetFixedStruct(_p, 8, position);
+  flatbuffers::WriteScalar<uint16_t>(_p + 6, sensor);
+  flatbuffers::WriteScalar<uint8_t>(_p + 5, static_cast<uint8_t>(valid));
+  flatbuffers::WriteScalar<uint8_t>(_p + 4, static_cast<uint8_t>(status));
+  return flatbuffers::Offset<Sample>(_fbb.EndFixedTable(vtable));
+}
+
+flatbuffers::Offset<Sample> CreateSample(flatbuffers::FlatBufferBuilder &_fbb, const SampleT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const SampleT &_o);
+
+struct LogT : public flatbuffers::NativeTable {
+  typedef Log TableType;
+  std::vector<flatbuffers::unique_ptr<precomputed_vtable_test::SampleT>> samples{};
+};
+
+inline bool operator==(const LogT &lhs, const LogT &rhs) {
+  return
+      (lhs.samples == rhs.samples);
+}
+
+inline bool operator!=(const LogT &lhs, const LogT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Log FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LogT NativeTableType;
+  typedef LogBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return LogTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SAMPLES = 4
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<precomputed_vtable_test::Sample>> *samples() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<precomputed_vtable_test::Sample>> *>(VT_SAMPLES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<precomputed_vtable_test::Sample>> *mutable_samples() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<precomputed_vtable_test::Sample>> *>(VT_SAMPLES);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SAMPLES) &&
+           verifier.VerifyVector(samples()) &&
+           verifier.VerifyVectorOfTables(samples()) &&
+           verifier.EndTable();
+  }
+  LogT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(LogT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Log> Pack(flatbuffers::FlatBufferBuilder &_fbb, const LogT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct LogBuilder {
+  typedef Log Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_samples(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<precomputed_vtable_test::Sample>>> samples) {
+    fbb_.AddOffset(Log::VT_SAMPLES, samples);
+  }
+  explicit LogBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Log> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Log>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Log> CreateLog(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<precomputed_vtable_test::Sample>>> samples = 0) {
+  LogBuilder builder_(_fbb);
+  builder_.add_samples(samples);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Log> CreateLogDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<precomputed_vtable_test::Sample>> *samples = nullptr) {
+  auto samples__ = samples ? _fbb.CreateVector<flatbuffers::Offset<precomputed_vtable_test::Sample>>(*samples) : 0;
+  return precomputed_vtable_test::CreateLog(
+      _fbb,
+      samples__);
+}
+
+flatbuffers::Offset<Log> CreateLog(flatbuffers::FlatBufferBuilder &_fbb, const LogT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const LogT &_o);
+
+inline SampleT *Sample::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<SampleT>(new SampleT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Sample::UnPackTo(SampleT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = timestamp(); _o->timestamp = _e; }
+  { auto _e = sensor(); _o->sensor = _e; }
+  { auto _e = position(); if (_e) _o->position = flatbuffers::unique_ptr<precomputed_vtable_test::Vec3>(new precomputed_vtable_test::Vec3(*_e)); }
+  { auto _e = temperature(); _o->temperature = _e; }
+  { auto _e = status(); _o->status = _e; }
+  { auto _e = valid(); _o->valid = _e; }
+  { auto _e = pressure(); _o->pressure = _e; }
+}
+
+inline size_t GetPackedSizeUpperBound(const SampleT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(8, 49);
+  return _size;
+}
+
+inline flatbuffers::Offset<Sample> Sample::Pack(flatbuffers::FlatBufferBuilder &_fbb, const SampleT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateSample(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Sample> CreateSample(flatbuffers::FlatBufferBuilder &_fbb, const SampleT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const SampleT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _timestamp = _o->timestamp;
+  auto _sensor = _o->sensor;
+  auto _position = _o->position ? _o->position.get() : 0;
+  auto _temperature = _o->temperature;
+  auto _status = _o->status;
+  auto _valid = _o->valid;
+  auto _pressure = _o->pressure;
+  return precomputed_vtable_test::CreateSample(
+      _fbb,
+      _timestamp,
+      _sensor,
+      _position,
+      _temperature,
+      _status,
+      _valid,
+      _pressure);
+}
+
+inline LogT *Log::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<LogT>(new LogT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Log::UnPackTo(LogT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = samples(); if (_e) { _o->samples.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->samples[_i] = flatbuffers::unique_ptr<precomputed_vtable_test::SampleT>(_e->Get(_i)->UnPack(_resolver)); } } }
+}
+
+inline size_t GetPackedSizeUpperBound(const LogT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 7);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.samples.size(), 4, 4);
+  for (const auto &_e : _o.samples) _size += GetPackedSizeUpperBound(*_e.get());
+  return _size;
+}
+
+inline flatbuffers::Offset<Log> Log::Pack(flatbuffers::FlatBufferBuilder &_fbb, const LogT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
+  return CreateLog(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Log> CreateLog(flatbuffers::FlatBufferBuilder &_fbb, const LogT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const LogT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _samples = _o->samples.size() ? _fbb.CreateVector<flatbuffers::Offset<precomputed_vtable_test::Sample>> (_o->samples.size(), [](size_t i, _VectorArgs *__va) { return CreateSample(*__va->__fbb, __va->__o->samples[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return precomputed_vtable_test::CreateLog(
+      _fbb,
+      _samples);
+}
+
+inline const flatbuffers::TypeTable *StatusTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 },
+    { flatbuffers::ET_UCHAR, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    precomputed_vtable_test::StatusTypeTable
+  };
+  static const char * const names[] = {
+    "Ok",
+    "Degraded",
+    "Failed"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_ENUM, 3, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *Vec3TypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const int64_t values[] = { 0, 4, 8, 12 };
+  static const char * const names[] = {
+    "x",
+    "y",
+    "z"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_STRUCT, 3, type_codes, nullptr, nullptr, values, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *SampleTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_USHORT, 0, -1 },
+    { flatbuffers::ET_INT, 0, -1 },
+    { flatbuffers::ET_SEQUENCE, 0, 0 },
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_UCHAR, 0, 1 },
+    { flatbuffers::ET_BOOL, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    precomputed_vtable_test::Vec3TypeTable,
+    precomputed_vtable_test::StatusTypeTable
+  };
+  static const char * const names[] = {
+    "timestamp",
+    "sensor",
+    "old_reading",
+    "position",
+    "temperature",
+    "status",
+    "valid",
+    "pressure"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 8, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *LogTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    precomputed_vtable_test::SampleTypeTable
+  };
+  static const char * const names[] = {
+    "samples"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const precomputed_vtable_test::Log *GetLog(const void *buf) {
+  return flatbuffers::GetRoot<precomputed_vtable_test::Log>(buf);
+}
+
+inline const precomputed_vtable_test::Log *GetSizePrefixedLog(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<precomputed_vtable_test::Log>(buf);
+}
+
+inline Log *GetMutableLog(void *buf) {
+  return flatbuffers::GetMutableRoot<Log>(buf);
+}
+
+inline bool VerifyLogBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<precomputed_vtable_test::Log>(nullptr);
+}
+
+inline bool VerifySizePrefixedLogBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<precomputed_vtable_test::Log>(nullptr);
+}
+
+inline void FinishLogBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<precomputed_vtable_test::Log> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedLogBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<precomputed_vtable_test::Log> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<precomputed_vtable_test::LogT> UnPackLog(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<precomputed_vtable_test::LogT>(GetLog(buf)->UnPack(res));
+}
+
+inline flatbuffers::unique_ptr<precomputed_vtable_test::LogT> UnPackSizePrefixedLog(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<precomputed_vtable_test::LogT>(GetSizePrefixedLog(buf)->UnPack(res));
+}
+
+}  // namespace precomputed_vtable_test
+
+#endif  // FLATBUFFERS_GENERATED_PRECOMPUTEDVTABLETEST_PRECOMPUTED_VTABLE_TEST_H_
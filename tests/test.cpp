@@ -14,12 +14,18 @@
  * limitations under the License.
  */
 #include <cmath>
+#include <set>
 
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
+#include "flatbuffers/parallel_verifier.h"
 #include "flatbuffers/registry.h"
 #include "flatbuffers/util.h"
+#include "flatbuffers/vector_kernels.h"
+#if !defined(_WIN32)
+#  include "flatbuffers/mmap_builder.h"
+#endif
 
 // clang-format off
 #ifdef FLATBUFFERS_CPP98_STL
@@ -34,6 +40,10 @@
 #include "namespace_test/namespace_test2_generated.h"
 #include "union_vector/union_vector_generated.h"
 #include "optional_scalars_generated.h"
+#include "offset64_test_generated.h"
+#include "precomputed_vtable_test_generated.h"
+#include "eytzinger_test_generated.h"
+#include "hash_index_test_generated.h"
 #if !defined(_MSC_VER) || _MSC_VER >= 1700
 #  include "monster_extra_generated.h"
 #  include "arrays_test_generated.h"
@@ -3235,8 +3245,7 @@ void CreateSharedStringTest() {
   TEST_EQ(a[5]->str(), (std::string(chars_c, sizeof(chars_c))));
   TEST_EQ(a[6]->str(), (std::string(chars_b, sizeof(chars_b))));
 
-  // Make sure String::operator< works, too, since it is related to
-  // StringOffsetCompare.
+  // Make sure String::operator< works, too.
   TEST_EQ((*a[0]) < (*a[1]), true);
   TEST_EQ((*a[1]) < (*a[0]), false);
   TEST_EQ((*a[1]) < (*a[2]), false);
@@ -3245,6 +3254,1539 @@ void CreateSharedStringTest() {
   TEST_EQ((*a[5]) < (*a[4]), false);
   TEST_EQ((*a[5]) < (*a[4]), false);
   TEST_EQ((*a[6]) < (*a[5]), true);
+
+  // Many strings, interned twice, with the pool reused across Clear().
+  flatbuffers::FlatBufferBuilder many;
+  for (int pass = 0; pass < 2; pass++) {
+    std::vector<flatbuffers::Offset<flatbuffers::String>> offsets;
+    for (int i = 0; i < 1000; i++) {
+      offsets.push_back(many.CreateSharedString(flatbuffers::NumToString(i)));
+    }
+    const auto size_before_dups = many.GetSize();
+    for (int i = 0; i < 1000; i++) {
+      const auto dup = many.CreateSharedString(flatbuffers::NumToString(i));
+      TEST_EQ(dup.o, offsets[i].o);
+    }
+    // Duplicates must not write anything to the buffer.
+    TEST_EQ(many.GetSize(), size_before_dups);
+    many.Clear();
+  }
+}
+
+// Builds tables with many distinct layouts, some of them repeated.
+static void BuildManyTableShapes(flatbuffers::FlatBufferBuilder &builder) {
+  std::vector<flatbuffers::Offset<flatbuffers::Table>> tables;
+  for (int pass = 0; pass < 3; pass++) {
+    // The second batch is built with dedup disabled, which writes a vtable
+    // for every table. Dedup is enabled again for the third.
+    builder.DedupVtables(pass != 1);
+    for (uint32_t shape = 1; shape < 300; shape++) {
+      auto start = builder.StartTable();
+      for (flatbuffers::voffset_t field = 0; field < 9; field++) {
+        if (shape & (1u << field)) {
+          builder.AddElement<uint32_t>(flatbuffers::FieldIndexToOffset(field),
+                                       shape, 0);
+        }
+      }
+      tables.push_back(builder.EndTable(start));
+    }
+  }
+  builder.DedupVtables(true);
+  builder.Finish(builder.CreateVector(tables));
+}
+
+void VtableDedupHashedTest() {
+  flatbuffers::FlatBufferBuilder linear;
+  BuildManyTableShapes(linear);
+  // Tables of the second batch all have a vtable of their own, written right
+  // before them, while those of the third mostly reuse earlier ones.
+  auto tables = flatbuffers::GetRoot<
+      flatbuffers::Vector<flatbuffers::Offset<flatbuffers::Table>>>(
+      linear.GetBufferPointer());
+  TEST_EQ(tables->size(), 3 * 299U);
+  size_t own_vtables[3] = { 0, 0, 0 };
+  for (flatbuffers::uoffset_t i = 0; i < tables->size(); i++) {
+    auto table = tables->Get(i);
+    auto vtable = table->GetVTable();
+    if (vtable + flatbuffers::ReadScalar<flatbuffers::voffset_t>(vtable) ==
+        reinterpret_cast<const uint8_t *>(table)) {
+      own_vtables[i / 299]++;
+    }
+  }
+  TEST_EQ(own_vtables[1], 299U);
+  TEST_EQ(own_vtables[2] < 299 / 2, true);
+
+  flatbuffers::FlatBufferBuilder hashed;
+  hashed.DedupVtablesHashed(true);
+  for (int i = 0; i < 2; i++) {
+    BuildManyTableShapes(hashed);
+    TEST_EQ(hashed.GetSize(), linear.GetSize());
+    TEST_EQ(memcmp(hashed.GetBufferPointer(), linear.GetBufferPointer(),
+                   linear.GetSize()),
+            0);
+    hashed.Clear();  // The index must be reset with the builder.
+  }
+}
+
+// With `rejects` set, also builds records that get discarded again, which
+// must leave no trace in the result.
+static void BuildManyMonsters(flatbuffers::FlatBufferBuilder &builder,
+                              bool rejects = false) {
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 500; i++) {
+    if (rejects && i % 3 == 0) {
+      auto mark = builder.Mark();
+      // Same name and shape as the next record, and a large payload.
+      auto name = builder.CreateSharedString(
+          "monster" + flatbuffers::NumToString((i + 1) % 300));
+      std::vector<uint8_t> inventory(static_cast<size_t>(i * 7 % 1000), 3);
+      auto inv = builder.CreateVector(inventory);
+      MonsterBuilder mb(builder);
+      mb.add_name(name);
+      mb.add_inventory(inv);
+      mb.add_hp(static_cast<int16_t>(i));
+      mb.add_mana(static_cast<int16_t>(i));
+      mb.Finish();
+      builder.CreateString("rejected");
+      builder.RewindTo(mark);
+    }
+    auto name = builder.CreateSharedString(
+        "monster" + flatbuffers::NumToString(i % 300));
+    std::vector<uint8_t> inventory(static_cast<size_t>(i % 50), 7);
+    auto inv = builder.CreateVector(inventory);
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    mb.add_inventory(inv);
+    mb.add_hp(static_cast<int16_t>(i));
+    monsters.push_back(mb.Finish());
+  }
+  auto sorted = builder.CreateVectorOfSortedTables(&monsters);
+  auto root_name = builder.CreateString("root");
+  MonsterBuilder root(builder);
+  root.add_name(root_name);
+  root.add_testarrayoftables(sorted);
+  FinishMonsterBuffer(builder, root.Finish());
+}
+
+void SegmentedBufferTest() {
+  flatbuffers::FlatBufferBuilder contiguous;
+  BuildManyMonsters(contiguous);
+  const std::string expected(
+      reinterpret_cast<const char *>(contiguous.GetBufferPointer()),
+      contiguous.GetSize());
+
+  flatbuffers::FlatBufferBuilder segmented(16);
+  segmented.SegmentedBuffer(true);
+  for (int i = 0; i < 2; i++) {
+    BuildManyMonsters(segmented);
+    auto segments = segmented.GetBufferSegments();
+    // Once cleared, the last block is reused and may well fit everything.
+    if (i == 0) TEST_EQ(segments.size() > 1, true);
+    std::string joined;
+    for (auto it = segments.begin(); it != segments.end(); ++it) {
+      joined.append(reinterpret_cast<const char *>(it->data()), it->size());
+    }
+    TEST_EQ(joined == expected, true);
+
+    segmented.FlattenBuffer();
+    TEST_EQ(segmented.GetBufferSegments().size(), static_cast<size_t>(1));
+    TEST_EQ(std::string(reinterpret_cast<const char *>(
+                            segmented.GetBufferPointer()),
+                        segmented.GetSize()) == expected,
+            true);
+    flatbuffers::Verifier verifier(segmented.GetBufferPointer(),
+                                   segmented.GetSize());
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    segmented.Clear();
+  }
+}
+
+void RewindToTest() {
+  flatbuffers::FlatBufferBuilder plain;
+  BuildManyMonsters(plain);
+  const std::string expected(
+      reinterpret_cast<const char *>(plain.GetBufferPointer()),
+      plain.GetSize());
+
+  for (int mode = 0; mode < 3; mode++) {
+    flatbuffers::FlatBufferBuilder builder(16);
+    builder.DedupVtablesHashed(mode == 1);
+    builder.SegmentedBuffer(mode == 2);
+    for (int i = 0; i < 2; i++) {
+      BuildManyMonsters(builder, true);
+      builder.FlattenBuffer();
+      TEST_EQ(std::string(reinterpret_cast<const char *>(
+                              builder.GetBufferPointer()),
+                          builder.GetSize()) == expected,
+              true);
+      builder.Clear();
+    }
+  }
+
+  // The next table of the same shape must not refer to the discarded vtable.
+  flatbuffers::FlatBufferBuilder builder;
+  auto root_name = builder.CreateString("root");
+  auto mark = builder.Mark();
+  MonsterBuilder mb(builder);
+  mb.add_name(root_name);
+  mb.Finish();
+  builder.RewindTo(mark);
+  TEST_EQ(builder.GetSize(), mark.size);
+  builder.CreateString("overwrites the discarded table");
+  MonsterBuilder root(builder);
+  root.add_name(root_name);
+  FinishMonsterBuffer(builder, root.Finish());
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ_STR(GetMonster(builder.GetBufferPointer())->name()->c_str(), "root");
+
+  // Rewinding into the block sealed when a large string didn't fit, to just
+  // above where the new block starts.
+  flatbuffers::FlatBufferBuilder segmented(64);
+  segmented.SegmentedBuffer(true);
+  segmented.CreateString("abc");
+  auto segmented_mark = segmented.Mark();
+  segmented.CreateVector(std::vector<uint8_t>());
+  segmented.CreateString(std::string(200, 'x'));
+  segmented.RewindTo(segmented_mark);
+  TEST_EQ(segmented.GetSize(), segmented_mark.size);
+  auto zz = segmented.CreateString("zz");
+  auto inventory = segmented.CreateVector(std::vector<uint8_t>(3, 7));
+  MonsterBuilder segmented_root(segmented);
+  segmented_root.add_name(zz);
+  segmented_root.add_inventory(inventory);
+  FinishMonsterBuffer(segmented, segmented_root.Finish());
+  segmented.FlattenBuffer();
+  flatbuffers::Verifier segmented_verifier(segmented.GetBufferPointer(),
+                                           segmented.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(segmented_verifier), true);
+  auto segmented_monster = GetMonster(segmented.GetBufferPointer());
+  TEST_EQ_STR(segmented_monster->name()->c_str(), "zz");
+  TEST_EQ(segmented_monster->inventory()->Get(2), 7);
+}
+
+void ArenaAllocatorTest() {
+  flatbuffers::FlatBufferBuilder heap;
+  BuildManyMonsters(heap);
+
+  flatbuffers::ArenaAllocator arena(16 * 1024);
+  for (int i = 0; i < 2; i++) {
+    {
+      flatbuffers::FlatBufferBuilder fbb(64, &arena);
+      BuildManyMonsters(fbb);
+      TEST_EQ(fbb.GetSize(), heap.GetSize());
+      TEST_EQ(memcmp(fbb.GetBufferPointer(), heap.GetBufferPointer(),
+                     heap.GetSize()),
+              0);
+      // The builder was the only user of the arena, so it grew in place.
+      TEST_EQ(arena.GetStats().num_in_place_reallocations > 0, true);
+
+      // The object API packs through a builder, so it can use the arena too.
+      flatbuffers::unique_ptr<MonsterT> monster(
+          GetMonster(fbb.GetBufferPointer())->UnPack());
+      flatbuffers::FlatBufferBuilder packed(64, &arena);
+      packed.Finish(Monster::Pack(packed, monster.get()));
+      auto released = packed.Release();
+      auto root = GetMonster(released.data());
+      TEST_EQ_STR(root->name()->c_str(), "root");
+      TEST_EQ(root->testarrayoftables()->size(), 500U);
+      TEST_EQ_STR(root->testarrayoftables()->Get(499)->name()->c_str(),
+                  "monster99");
+    }
+    // Everything allocated from the arena is gone now.
+    arena.Reset();
+    TEST_EQ(arena.GetStats().num_blocks, static_cast<size_t>(1));
+  }
+}
+
+void MmapFileBuilderTest() {
+  // clang-format off
+  #if !defined(_WIN32) && !defined(FLATBUFFERS_NO_FILE_TESTS)
+    const char *path = "mmap_builder_test.mon";
+    // Also after starting over, the buffer stays padded to pages.
+    for (int restart = 0; restart < 3; restart++) {
+      {
+        flatbuffers::MmapFileBuilder fbb(path);
+        TEST_EQ(fbb.ok(), true);
+        if (restart) {
+          BuildManyMonsters(fbb);
+          if (restart == 1) {
+            fbb.Clear();
+          } else {
+            fbb.Reset();
+          }
+        }
+        BuildManyMonsters(fbb);
+        TEST_EQ(fbb.Commit(), true);
+      }
+      std::string file;
+      TEST_EQ(flatbuffers::LoadFile(path, true, &file), true);
+      std::remove(path);
+      TEST_EQ(file.size() % static_cast<size_t>(sysconf(_SC_PAGESIZE)), 0U);
+      flatbuffers::Verifier verifier(
+          reinterpret_cast<const uint8_t *>(file.data()), file.size());
+      TEST_EQ(VerifyMonsterBuffer(verifier), true);
+      auto root = GetMonster(file.data());
+      TEST_EQ_STR(root->name()->c_str(), "root");
+      TEST_EQ(root->testarrayoftables()->size(), 500U);
+      TEST_EQ_STR(root->testarrayoftables()->Get(499)->name()->c_str(),
+                  "monster99");
+    }
+  #endif
+  // clang-format on
+}
+
+void BufferSizeHintTest() {
+  // The arena counts the allocations made by each builder.
+  flatbuffers::ArenaAllocator arena(1 << 20);
+  flatbuffers::BufferSizeHint hint(64);
+  for (int i = 0; i < 3; i++) {
+    auto before = arena.GetStats();
+    {
+      flatbuffers::FlatBufferBuilder fbb(64, &arena);
+      fbb.UseSizeHint(&hint);
+      BuildManyMonsters(fbb);
+      TEST_EQ(hint.Get() >= fbb.GetSize(), true);
+    }
+    auto after = arena.GetStats();
+    // Once the hint has learned the size, the buffer never needs to grow.
+    TEST_EQ(after.num_allocations - before.num_allocations == 1 &&
+                after.num_in_place_reallocations ==
+                    before.num_in_place_reallocations,
+            i > 0);
+    arena.Reset();
+  }
+
+  // An outlier does not pin the hint, and Clear() gives up a buffer that
+  // grew much larger than the hint.
+  {
+    flatbuffers::FlatBufferBuilder fbb(64, &arena);
+    fbb.UseSizeHint(&hint);
+    BuildManyMonsters(fbb);
+    TEST_EQ(hint.Get() >= fbb.GetSize(), true);
+    for (int i = 0; i < 200; i++) hint.Update(1000);
+    TEST_EQ(hint.Get() >= 1000 && hint.Get() < 1100, true);
+    fbb.Clear();
+    auto num_allocations = arena.GetStats().num_allocations;
+    fbb.CreateString("small");
+    TEST_EQ(arena.GetStats().num_allocations, num_allocations + 1);
+  }
+  arena.Reset();
+}
+
+static void BuildRepetitiveMonsters(flatbuffers::FlatBufferBuilder &builder) {
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 100; i++) {
+    auto name = builder.CreateSharedString(
+        "monster" + flatbuffers::NumToString(i % 5));
+    std::vector<uint8_t> inventory(10, static_cast<uint8_t>(i % 3));
+    auto inv = builder.CreateSharedVector(inventory);
+    std::vector<Test> tests(3, Test(10, 20));
+    auto test4 = builder.CreateSharedVectorOfStructs(tests);
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    mb.add_inventory(inv);
+    mb.add_test4(test4);
+    mb.add_hp(static_cast<int16_t>(i % 2));
+    monsters.push_back(mb.Finish());
+  }
+  auto vec = builder.CreateSharedVector(monsters);
+  // The same monsters again, so the same vector.
+  TEST_EQ(builder.CreateSharedVector(monsters).o, vec.o);
+  auto root_name = builder.CreateString("root");
+  MonsterBuilder root(builder);
+  root.add_name(root_name);
+  root.add_testarrayoftables(vec);
+  FinishMonsterBuffer(builder, root.Finish());
+}
+
+void SharedObjectsTest() {
+  flatbuffers::FlatBufferBuilder plain;
+  BuildRepetitiveMonsters(plain);
+
+  flatbuffers::FlatBufferBuilder dedup;
+  dedup.DedupTables(true);
+  BuildRepetitiveMonsters(dedup);
+  TEST_EQ(dedup.GetSize() < plain.GetSize(), true);
+  flatbuffers::Verifier verifier(dedup.GetBufferPointer(), dedup.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+
+  // The monsters differ in name, inventory and hp, so 30 remain.
+  auto monsters = GetMonster(dedup.GetBufferPointer())->testarrayoftables();
+  TEST_EQ(monsters->size(), 100U);
+  std::set<const Monster *> distinct(monsters->begin(), monsters->end());
+  TEST_EQ(distinct.size(), 30U);
+  TEST_EQ(monsters->Get(30), monsters->Get(0));
+  TEST_EQ(monsters->Get(0)->inventory(), monsters->Get(3)->inventory());
+
+  // Sharing does not change the contents.
+  flatbuffers::unique_ptr<MonsterT> expected(
+      GetMonster(plain.GetBufferPointer())->UnPack());
+  flatbuffers::unique_ptr<MonsterT> actual(
+      GetMonster(dedup.GetBufferPointer())->UnPack());
+  TEST_EQ(expected->testarrayoftables.size(),
+          actual->testarrayoftables.size());
+  for (size_t i = 0; i < expected->testarrayoftables.size(); i++) {
+    TEST_EQ(*expected->testarrayoftables[i] == *actual->testarrayoftables[i],
+            true);
+  }
+}
+
+void VerifySharedTest() {
+  // Each monster refers to the next one three times, so there are 3^20 paths
+  // to the last one, but only 21 monsters.
+  flatbuffers::FlatBufferBuilder fbb;
+  auto strings = fbb.CreateVectorOfStrings({ "a", "b", "c" });
+  flatbuffers::Offset<Monster> next;
+  for (int i = 0; i < 21; i++) {
+    std::vector<flatbuffers::Offset<Monster>> children;
+    if (!next.IsNull()) children.assign(2, next);
+    auto name = fbb.CreateSharedString("monster");
+    auto tables = fbb.CreateVector(children);
+    MonsterBuilder mb(fbb);
+    mb.add_name(name);
+    mb.add_testarrayofstring(strings);
+    mb.add_testarrayoftables(tables);
+    if (!next.IsNull()) mb.add_enemy(next);
+    next = mb.Finish();
+  }
+  FinishMonsterBuffer(fbb, next);
+
+  // Fails on the table count if verifying every path, but each monster is
+  // verified once when tracking visited tables.
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize(), 64,
+                                 21, true, true);
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(verifier.GetNumTables(), 21U);
+
+  // The same without checking alignment, which tracks every byte offset.
+  flatbuffers::Verifier unaligned(fbb.GetBufferPointer(), fbb.GetSize(), 64,
+                                  21, false, true);
+  TEST_EQ(VerifyMonsterBuffer(unaligned), true);
+  TEST_EQ(unaligned.GetNumTables(), 21U);
+
+  // Without sharing, nothing changes.
+  flatbuffers::FlatBufferBuilder plain;
+  BuildRepetitiveMonsters(plain);
+  flatbuffers::Verifier all(plain.GetBufferPointer(), plain.GetSize());
+  flatbuffers::Verifier unique(plain.GetBufferPointer(), plain.GetSize(), 64,
+                               1000000, true, true);
+  TEST_EQ(VerifyMonsterBuffer(all), true);
+  TEST_EQ(VerifyMonsterBuffer(unique), true);
+  TEST_EQ(all.GetNumTables(), unique.GetNumTables());
+}
+
+void VerifierVTableCacheTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  BuildRepetitiveMonsters(fbb);
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  // Each table's vtable is checked once, unless evicted from the cache.
+  TEST_EQ(verifier.GetVTableCacheHits() + verifier.GetVTableCacheMisses(),
+          verifier.GetNumTables());
+  TEST_EQ(verifier.GetNumTables(), 101U);
+  TEST_EQ(verifier.GetVTableCacheMisses() <= 3, true);
+}
+
+void ParallelVerifyTest() {
+  // A vector of monsters with enemies, and one with a vector of monsters too.
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 1000; i++) {
+    auto enemy = CreateMonster(fbb, nullptr, 0, 0, fbb.CreateString("enemy"));
+    std::vector<flatbuffers::Offset<Monster>> children;
+    if (i == 500) children.assign(300, enemy);
+    auto children_vec = fbb.CreateVector(children);
+    auto monster_name = fbb.CreateString("monster" +
+                                         flatbuffers::NumToString(i));
+    MonsterBuilder monster(fbb);
+    monster.add_name(monster_name);
+    monster.add_hp(static_cast<int16_t>(i));
+    monster.add_testarrayoftables(children_vec);
+    monster.add_enemy(enemy);
+    monsters.push_back(monster.Finish());
+  }
+  auto tables = fbb.CreateVector(monsters);
+  auto name = fbb.CreateString("root");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_testarrayoftables(tables);
+  FinishMonsterBuffer(fbb, mb.Finish());
+
+  flatbuffers::Verifier sequential(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(sequential), true);
+  TEST_EQ(sequential.GetNumTables(), 2301U);
+
+  // On threads, and on an executor running the parts one after the other,
+  // with parts of different sizes. The vector of 300 monsters is in one of
+  // the parts, so is verified by its fork. Exactly as many tables as there
+  // are is fine.
+  size_t runs = 0;
+  flatbuffers::ParallelVerification threads(4, 100);
+  flatbuffers::ParallelVerification serial(
+      [&](size_t count, const std::function<void(size_t)> &task) {
+        for (size_t i = count; i-- > 0;) task(i);
+        runs++;
+      },
+      3, 100);
+  flatbuffers::ParallelVerification *parallelisms[] = { &threads, &serial };
+  for (size_t i = 0; i < 2; i++) {
+    flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize(), 64,
+                                   2301);
+    verifier.SetParallelism(parallelisms[i]);
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    TEST_EQ(verifier.GetNumTables(), sequential.GetNumTables());
+    TEST_EQ(verifier.GetVTableCacheHits() + verifier.GetVTableCacheMisses(),
+            2301U);
+    TEST_EQ(verifier.GetComputedSize(), sequential.GetComputedSize());
+    TEST_EQ(verifier.GetNumBytes(), sequential.GetNumBytes());
+    // clang-format off
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+      TEST_EQ(verifier.GetStats().tables, 2301U);
+      TEST_EQ(verifier.GetStats().max_depth, 3U);
+    #endif
+    // clang-format on
+  }
+  TEST_EQ(runs, 1U);
+}
+
+void VerifierStatsTest() {
+  // A monster with an inventory, and two monsters in a vector.
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Monster>> children;
+  for (int i = 0; i < 2; i++) {
+    children.push_back(CreateMonster(fbb, nullptr, 0, 0, fbb.CreateString("a")));
+  }
+  auto children_vec = fbb.CreateVector(children);
+  auto inventory = fbb.CreateVector(std::vector<uint8_t>(10, 0));
+  auto name = fbb.CreateString("root");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_inventory(inventory);
+  mb.add_testarrayoftables(children_vec);
+  FinishMonsterBuffer(fbb, mb.Finish());
+
+  // Vectors and strings of 14 + 12 and 8 + 5 + 5 bytes, with their sizes.
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(verifier.GetNumBytes(), 44U);
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_VERIFIER_STATS
+    auto stats = verifier.GetStats();
+    TEST_EQ(stats.buffers, 1U);
+    TEST_EQ(stats.tables, 3U);
+    TEST_EQ(stats.max_depth, 2U);
+    TEST_EQ(stats.vector_bytes, 26U);
+    TEST_EQ(stats.string_bytes, 18U);
+    TEST_EQ(stats.failed, false);
+    TEST_EQ(stats.failure_path.size(), 0U);
+    stats += verifier.GetStats();
+    TEST_EQ(stats.buffers, 2U);
+    TEST_EQ(stats.tables, 6U);
+    TEST_EQ(stats.max_depth, 2U);
+  #endif
+  // clang-format on
+
+  // Budgets that are just enough.
+  flatbuffers::Verifier budgeted(fbb.GetBufferPointer(), fbb.GetSize());
+  budgeted.SetMaxBytes(44);
+  budgeted.SetDeadline(std::chrono::steady_clock::now() +
+                       std::chrono::hours(1));
+  TEST_EQ(VerifyMonsterBuffer(budgeted), true);
+}
+
+void BuilderStatsTest() {
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    flatbuffers::FlatBufferBuilder fbb(64);
+    BuildManyMonsters(fbb);
+    auto stats = fbb.GetStats();
+    TEST_EQ(stats.shared_string_hits, 200U);
+    TEST_EQ(stats.shared_string_misses, 300U);
+    // Monsters with and without hp, and the root.
+    TEST_EQ(stats.vtables_written, 3U);
+    TEST_EQ(stats.vtables_deduped, 498U);
+    TEST_EQ(stats.reallocations > 0 && stats.bytes_moved > 0, true);
+    TEST_EQ(stats.padding_bytes > 0, true);
+    TEST_EQ(stats.peak_scratch_size >= 3 * sizeof(flatbuffers::uoffset_t),
+            true);
+
+    // Growing the buffer in place only moves the scratch area.
+    flatbuffers::ArenaAllocator arena(1 << 20);
+    flatbuffers::FlatBufferBuilder in_place(64, &arena);
+    BuildManyMonsters(in_place);
+    const auto &arena_stats = in_place.GetStats();
+    TEST_EQ(arena_stats.reallocations, stats.reallocations);
+    TEST_EQ(arena_stats.bytes_moved <=
+                arena_stats.reallocations * arena_stats.peak_scratch_size,
+            true);
+    TEST_EQ(arena_stats.bytes_moved < stats.bytes_moved, true);
+
+    // Counters accumulate across Clear(), until reset.
+    fbb.Clear();
+    BuildManyMonsters(fbb);
+    TEST_EQ(fbb.GetStats().vtables_written, 6U);
+    TEST_EQ(fbb.GetStats().reallocations, stats.reallocations);
+    flatbuffers::BuilderStats total;
+    total += stats;
+    total += fbb.GetStats();
+    TEST_EQ(total.shared_string_hits, 600U);
+    TEST_EQ(total.peak_scratch_size, stats.peak_scratch_size);
+    fbb.ResetStats();
+    TEST_EQ(fbb.GetStats().vtables_written, 0U);
+  #endif
+  // clang-format on
+}
+
+void PackedSizeUpperBoundTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  BuildManyMonsters(fbb);
+  flatbuffers::unique_ptr<MonsterT> monster(
+      GetMonster(fbb.GetBufferPointer())->UnPack());
+  monster->testarrayofstring.assign(100, "a string");
+  MonsterT child;
+  child.name = "child";
+  monster->test.Set(std::move(child));
+  auto bound = GetPackedSizeUpperBound(*monster);
+
+  // Pack() reserves the bound up front, so the buffer never grows.
+  flatbuffers::FlatBufferBuilder packed(64);
+  auto root = Monster::Pack(packed, monster.get());
+  TEST_EQ(packed.GetSize() <= bound, true);
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    TEST_EQ(packed.GetStats().reallocations, 0U);
+  #endif
+  // clang-format on
+  FinishMonsterBuffer(packed, root);
+
+  flatbuffers::Verifier verifier(packed.GetBufferPointer(), packed.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto copy = GetMonster(packed.GetBufferPointer());
+  TEST_EQ(copy->testarrayoftables()->size(), 500U);
+  TEST_EQ(copy->testarrayofstring()->size(), 100U);
+  TEST_EQ_STR(copy->test_as_Monster()->name()->c_str(), "child");
+
+  // Reserve() makes room without changing the contents.
+  flatbuffers::FlatBufferBuilder reserved(64);
+  reserved.Reserve(bound);
+  TEST_EQ(reserved.GetSize(), 0U);
+  reserved.Finish(CreateMonster(reserved, monster.get()));
+  TEST_EQ(reserved.GetSize(), packed.GetSize() - 4);  // No file identifier.
+}
+
+void SpliceTest() {
+  // Build groups of monsters in separate builders, as worker threads would,
+  // some of them segmented, and with a table that needs 8 byte alignment.
+  const int kGroups = 4;
+  flatbuffers::FlatBufferBuilder children[kGroups];
+  std::vector<flatbuffers::Offset<Monster>> offsets[kGroups];
+  for (int g = 0; g < kGroups; g++) {
+    auto &child = children[g];
+    child.SegmentedBuffer(g % 2 == 1);
+    for (int i = 0; i < 100; i++) {
+      auto name = child.CreateString("monster" +
+                                     flatbuffers::NumToString(g * 100 + i));
+      std::vector<int64_t> longs(static_cast<size_t>(i % 3), i);
+      auto vl = child.CreateVector(longs);
+      MonsterBuilder mb(child);
+      mb.add_name(name);
+      mb.add_vector_of_longs(vl);
+      mb.add_hp(static_cast<int16_t>(i));
+      offsets[g].push_back(mb.Finish());
+    }
+  }
+
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.CreateString("unaligned");
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int g = 0; g < kGroups; g++) {
+    auto delta = fbb.Splice(children[g]);
+    for (auto it = offsets[g].begin(); it != offsets[g].end(); ++it) {
+      monsters.push_back(flatbuffers::Offset<Monster>(it->o + delta));
+    }
+  }
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    auto written = fbb.GetStats().vtables_written;
+  #endif
+  // clang-format on
+  // A monster built here reuses the vtable spliced from a child.
+  auto name = fbb.CreateString("last");
+  auto no_longs = fbb.CreateVector(std::vector<int64_t>());
+  MonsterBuilder last(fbb);
+  last.add_name(name);
+  last.add_vector_of_longs(no_longs);
+  last.add_hp(1);
+  monsters.push_back(last.Finish());
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    TEST_EQ(fbb.GetStats().vtables_written, written);
+  #endif
+  // clang-format on
+  auto root_name = fbb.CreateString("root");
+  // Splicing returns offsets of roots of a child directly.
+  auto child_root = fbb.Splice(children[0], offsets[0][7]);
+  auto vec = fbb.CreateVector(monsters);
+  MonsterBuilder root(fbb);
+  root.add_name(root_name);
+  root.add_testarrayoftables(vec);
+  root.add_enemy(child_root);
+  FinishMonsterBuffer(fbb, root.Finish());
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monster = GetMonster(fbb.GetBufferPointer());
+  auto tables = monster->testarrayoftables();
+  TEST_EQ(tables->size(), kGroups * 100U + 1);
+  for (flatbuffers::uoffset_t i = 0; i < kGroups * 100; i++) {
+    auto m = tables->Get(i);
+    TEST_EQ_STR(m->name()->c_str(),
+                ("monster" + flatbuffers::NumToString(i)).c_str());
+    TEST_EQ(m->hp(), static_cast<int16_t>(i % 100));
+    auto longs = m->vector_of_longs();
+    TEST_EQ(longs->size(), i % 100 % 3);
+    if (longs->size()) {
+      TEST_EQ(reinterpret_cast<uintptr_t>(longs->Data()) % 8, 0U);
+      TEST_EQ(longs->Get(0), static_cast<int64_t>(i % 100));
+    }
+  }
+  TEST_EQ_STR(tables->Get(kGroups * 100)->name()->c_str(), "last");
+  TEST_EQ_STR(monster->enemy()->name()->c_str(), "monster7");
+}
+
+void Offset64Test() {
+  using namespace offset64_test;
+  // Data referred to by 64-bit offsets is created first, and ends up at the
+  // end of the buffer.
+  flatbuffers::FlatBufferBuilder fbb;
+  auto mark = fbb.Mark();
+  fbb.CreateString64("dropped");
+  fbb.RewindTo(mark);
+  TEST_EQ(fbb.GetSize64(), 0U);
+  std::vector<Point> points;
+  for (int i = 0; i < 100; i++) {
+    points.push_back(Point(static_cast<float>(i), 2.0f * i, 3.0f * i));
+  }
+  std::vector<float> samples(1001, 0.5f);
+  auto points64 = fbb.CreateVectorOfStructs64(points);
+  fbb.ForceVectorAlignment64(samples.size(), sizeof(float), 16);
+  auto samples64 = fbb.CreateVector64(samples);
+  auto label64 = fbb.CreateString64("far away");
+  auto size64 = fbb.GetSize64();
+  TEST_EQ(fbb.GetSize(), 0U);
+  auto name = fbb.CreateString("cloud");
+  std::vector<std::string> tag_strings;
+  tag_strings.push_back("a");
+  tag_strings.push_back("b");
+  auto tags = fbb.CreateVectorOfStrings(tag_strings);
+  CloudBuilder cb(fbb);
+  cb.add_name(name);
+  cb.add_points(points64);
+  cb.add_samples(samples64);
+  cb.add_label(label64);
+  cb.add_tags(tags);
+  FinishCloudBuffer(fbb, cb.Finish());
+
+  auto buf = fbb.GetBufferPointer();
+  auto size = fbb.GetSize64();
+  flatbuffers::Verifier verifier(buf, size);
+  TEST_EQ(VerifyCloudBuffer(verifier), true);
+  auto cloud = GetCloud(buf);
+  TEST_EQ_STR(cloud->name()->c_str(), "cloud");
+  TEST_EQ_STR(cloud->label()->c_str(), "far away");
+  TEST_EQ(cloud->points()->size(), 100U);
+  TEST_EQ(cloud->points()->Get(7)->y(), 14.0f);
+  TEST_EQ(cloud->samples()->size(), 1001U);
+  TEST_EQ((cloud->samples()->Data() - buf) % 16, 0);
+  TEST_EQ(cloud->tags()->size(), 2U);
+  TEST_EQ(reinterpret_cast<const uint8_t *>(cloud->points()) >=
+              buf + size - size64,
+          true);
+
+  // The object API creates the 64-bit fields first too.
+  flatbuffers::unique_ptr<CloudT> unpacked(cloud->UnPack());
+  unpacked->kinds.push_back(Kind_Large);
+  unpacked->flags.push_back(true);
+  flatbuffers::FlatBufferBuilder fbb2;
+  FinishCloudBuffer(fbb2, Cloud::Pack(fbb2, unpacked.get()));
+  flatbuffers::Verifier verifier2(fbb2.GetBufferPointer(), fbb2.GetSize64());
+  TEST_EQ(VerifyCloudBuffer(verifier2), true);
+  flatbuffers::unique_ptr<CloudT> repacked(
+      GetCloud(fbb2.GetBufferPointer())->UnPack());
+  TEST_EQ(*repacked == *unpacked, true);
+
+  // Reflection and text output follow the attribute.
+  std::string schemafile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "offset64_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse(schemafile.c_str()), true);
+  parser.Serialize();
+  auto &schema = *reflection::GetSchema(parser.builder_.GetBufferPointer());
+  auto &root_table = *schema.root_table();
+  TEST_EQ(flatbuffers::Verify(schema, root_table, buf, size), true);
+  auto label_field = root_table.fields()->LookupByKey("label");
+  TEST_EQ(label_field->offset64(), true);
+  auto &root = *flatbuffers::GetAnyRoot(buf);
+  TEST_EQ_STR(flatbuffers::GetFieldS(root, *label_field)->c_str(), "far away");
+  auto samples_field = root_table.fields()->LookupByKey("samples");
+  TEST_EQ(flatbuffers::GetFieldV<float>(root, *samples_field)->Get(1000),
+          0.5f);
+  std::string json;
+  TEST_EQ(GenerateText(parser, buf, &json), true);
+  TEST_NOTNULL(strstr(json.c_str(), "label: \"far away\""));
+  // CopyTable() can't create 64-bit offset data ahead of the copy.
+  flatbuffers::FlatBufferBuilder fbb3;
+  TEST_EQ(flatbuffers::CopyTable(fbb3, schema, root_table, root).IsNull(),
+          true);
+
+  // Tables with 64-bit offsets aren't shared: equal offsets stored at
+  // different positions refer to different data.
+  for (size_t k = 12; k < 20; k++) {
+    flatbuffers::FlatBufferBuilder fbb4;
+    fbb4.DedupTables(true);
+    flatbuffers::Offset64<flatbuffers::String> labels[4];
+    for (int i = 0; i < 4; i++) {
+      labels[i] =
+          fbb4.CreateString64(std::string(k, static_cast<char>('a' + i)));
+    }
+    flatbuffers::Offset<Cloud> clouds[4];
+    for (int i = 0; i < 4; i++) {
+      CloudBuilder cb4(fbb4);
+      cb4.add_label(labels[i]);
+      clouds[i] = cb4.Finish();
+    }
+    for (int i = 0; i < 4; i++) {
+      auto cloud4 = flatbuffers::GetTemporaryPointer(fbb4, clouds[i]);
+      TEST_EQ(cloud4->label()->str(),
+              std::string(k, static_cast<char>('a' + i)));
+    }
+  }
+
+  TestError("table T { t:T (offset64); }", "offset64 may only");
+  TestError("table T { s:string (offset64, shared); }", "can't be combined");
+  TestError("table T { s:[S] (offset64); } table S { a:int; }",
+            "offset64 vectors may only hold structs");
+  TestError("table T { s:string (offset64); } root_type T; { s: \"a\" }",
+            "can't be parsed from JSON");
+}
+
+void PrecomputedVTableTest() {
+  using namespace precomputed_vtable_test;
+  flatbuffers::FlatBufferBuilder fbb;
+  // An equal vtable written by the regular builder is reused. For this table,
+  // started on an empty buffer and with its fields added in the order
+  // CreateX() stores them in, the layouts happen to match.
+  fbb.ForceDefaults(true);
+  SampleBuilder sb(fbb);
+  sb.add_timestamp(1);
+  sb.add_pressure(101.3f);
+  sb.add_temperature(0);
+  precomputed_vtable_test::Vec3 origin(0, 0, 0);
+  sb.add_position(&origin);
+  sb.add_sensor(0);
+  sb.add_valid(true);
+  sb.add_status(Status_Ok);
+  std::vector<flatbuffers::Offset<Sample>> samples(1, sb.Finish());
+  fbb.ForceDefaults(false);
+  for (int i = 1; i < 100; i++) {
+    precomputed_vtable_test::Vec3 position(static_cast<float>(i), 2.0f * i,
+                                           3.0f * i);
+    samples.push_back(CreateSample(
+        fbb, 1000000000000ULL + i, static_cast<uint16_t>(i),
+        i % 10 ? &position : nullptr, 0.5f * i,
+        i % 3 ? Status_Ok : Status_Failed, i % 2 == 0));
+  }
+  FinishLogBuffer(fbb, CreateLog(fbb, fbb.CreateVector(samples)));
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyLogBuffer(verifier), true);
+  auto log = GetLog(fbb.GetBufferPointer());
+  TEST_EQ(log->samples()->size(), 100U);
+  auto table_of = [&](flatbuffers::uoffset_t i) {
+    return reinterpret_cast<const flatbuffers::Table *>(log->samples()->Get(i));
+  };
+  for (flatbuffers::uoffset_t i = 1; i < 100; i++) {
+    auto sample = log->samples()->Get(i);
+    TEST_EQ(table_of(i)->GetVTable(), table_of(0)->GetVTable());
+    TEST_EQ(sample->timestamp(), 1000000000000ULL + i);
+    TEST_EQ(sample->sensor(), i);
+    TEST_EQ(sample->temperature(), 0.5f * i);
+    TEST_EQ(sample->status(), i % 3 ? Status_Ok : Status_Failed);
+    TEST_EQ(sample->valid(), i % 2 == 0);
+    TEST_EQ(sample->pressure(), 101.3f);
+    TEST_NOTNULL(sample->position());
+    TEST_EQ(sample->position()->y(), i % 10 ? 2.0f * i : 0.0f);
+  }
+  // clang-format off
+  #ifdef FLATBUFFERS_TRACK_BUILDER_STATS
+    // Only the Sample vtable from the builder, and the one of the Log.
+    TEST_EQ(fbb.GetStats().vtables_written, 2U);
+  #endif
+  // clang-format on
+
+  // The object API goes through the same CreateSample().
+  flatbuffers::unique_ptr<LogT> unpacked(log->UnPack());
+  flatbuffers::FlatBufferBuilder fbb2;
+  FinishLogBuffer(fbb2, Log::Pack(fbb2, unpacked.get()));
+  flatbuffers::Verifier verifier2(fbb2.GetBufferPointer(), fbb2.GetSize());
+  TEST_EQ(VerifyLogBuffer(verifier2), true);
+  auto relog = GetLog(fbb2.GetBufferPointer());
+  TEST_EQ(relog->samples()->size(), 100U);
+  TEST_EQ(relog->samples()->Get(42)->timestamp(), 1000000000042ULL);
+  TEST_EQ(relog->samples()->Get(42)->position()->z(), 126.0f);
+
+  // Rewinding past the vtable writes it again.
+  flatbuffers::FlatBufferBuilder fbb3;
+  auto mark = fbb3.Mark();
+  CreateSample(fbb3, 1);
+  fbb3.RewindTo(mark);
+  auto sample = CreateSample(fbb3, 2);
+  fbb3.Finish(sample);
+  flatbuffers::Verifier verifier3(fbb3.GetBufferPointer(), fbb3.GetSize());
+  TEST_EQ(verifier3.VerifyBuffer<Sample>(nullptr), true);
+  TEST_EQ(flatbuffers::GetRoot<Sample>(fbb3.GetBufferPointer())->timestamp(),
+          2U);
+
+  TestError("struct S (precomputed_vtable) { a:int; }",
+            "can't be used on structs");
+  TestError("table T (precomputed_vtable) { s:string; }",
+            "may only have non-optional scalar");
+  TestError("table T (precomputed_vtable) { a:int = null; }",
+            "may only have non-optional scalar");
+}
+
+void BulkVectorOfStringsTest() {
+  std::vector<std::string> strings;
+  std::string arena;
+  std::vector<flatbuffers::uoffset_t> offsets(1, 0);
+  for (int i = 0; i < 1000; i++) {
+    strings.push_back(std::string(static_cast<size_t>(i % 7), 'a' + i % 26));
+    arena += strings.back();
+    offsets.push_back(static_cast<flatbuffers::uoffset_t>(arena.size()));
+  }
+
+  // Same layout as creating the strings one by one.
+  flatbuffers::FlatBufferBuilder fbb1;
+  fbb1.CreateString("x");
+  std::vector<flatbuffers::Offset<flatbuffers::String>> string_offsets;
+  for (size_t i = 0; i < strings.size(); i++) {
+    string_offsets.push_back(fbb1.CreateString(strings[i]));
+  }
+  auto vec1 = fbb1.CreateVector(string_offsets);
+  flatbuffers::FlatBufferBuilder fbb2;
+  fbb2.CreateString("x");
+  auto vec2 = fbb2.CreateVectorOfStrings(strings);
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.CreateString("x");
+  auto vec3 = fbb3.CreateVectorOfStrings(arena.c_str(), offsets.data(),
+                                         strings.size());
+  TEST_EQ(vec1.o, vec2.o);
+  TEST_EQ(vec1.o, vec3.o);
+  TEST_EQ(fbb1.GetSize(), fbb2.GetSize());
+  TEST_EQ(memcmp(fbb1.GetCurrentBufferPointer(),
+                 fbb2.GetCurrentBufferPointer(), fbb1.GetSize()),
+          0);
+  TEST_EQ(memcmp(fbb1.GetCurrentBufferPointer(),
+                 fbb3.GetCurrentBufferPointer(), fbb1.GetSize()),
+          0);
+
+  fbb2.Finish(vec2);
+  auto vec = flatbuffers::GetRoot<
+      flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>>(
+      fbb2.GetBufferPointer());
+  flatbuffers::Verifier verifier(fbb2.GetBufferPointer(), fbb2.GetSize());
+  TEST_EQ(verifier.VerifyVector(vec) && verifier.VerifyVectorOfStrings(vec),
+          true);
+  TEST_EQ(vec->size(), 1000U);
+  TEST_EQ(vec->Get(999)->str(), strings[999]);
+
+  flatbuffers::FlatBufferBuilder fbb4;
+  auto empty = fbb4.CreateVectorOfStrings(arena.c_str(), offsets.data(), 0);
+  TEST_EQ(fbb4.GetSize(), static_cast<flatbuffers::uoffset_t>(
+                              sizeof(flatbuffers::uoffset_t)));
+  TEST_EQ(empty.o, fbb4.GetSize());
+
+  // Starting at an unaligned size, as after an odd sized vtable.
+  const std::vector<std::string> short_strings = { "ab", "c" };
+  for (size_t start = 1; start < 4; start++) {
+    flatbuffers::FlatBufferBuilder separate;
+    flatbuffers::FlatBufferBuilder bulk;
+    for (size_t i = 0; i < start; i++) {
+      separate.PushElement<uint8_t>(1);
+      bulk.PushElement<uint8_t>(1);
+    }
+    std::vector<flatbuffers::Offset<flatbuffers::String>> short_offsets;
+    for (size_t i = 0; i < short_strings.size(); i++) {
+      short_offsets.push_back(separate.CreateString(short_strings[i]));
+    }
+    auto separate_vec = separate.CreateVector(short_offsets);
+    auto bulk_vec = bulk.CreateVectorOfStrings(short_strings);
+    TEST_EQ(separate_vec.o, bulk_vec.o);
+    TEST_EQ(separate.GetSize(), bulk.GetSize());
+    TEST_EQ(memcmp(separate.GetCurrentBufferPointer(),
+                   bulk.GetCurrentBufferPointer(), bulk.GetSize()),
+            0);
+  }
+}
+
+void KeySortTest() {
+  lcg_reset();
+  flatbuffers::FlatBufferBuilder fbb;
+  // Enough elements for the radix sort, with equal keys and string keys
+  // that only differ beyond their prefix.
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  std::vector<flatbuffers::Offset<Stat>> stats;
+  std::vector<Ability> abilities;
+  for (int i = 0; i < 1000; i++) {
+    auto n = lcg_rand() % 500;
+    auto name = fbb.CreateString("monster_" + flatbuffers::NumToString(n));
+    monsters.push_back(CreateMonster(fbb, nullptr, 0, 0, name));
+    stats.push_back(CreateStat(fbb, 0, 0, static_cast<uint16_t>(n * 131)));
+    abilities.push_back(Ability(lcg_rand(), static_cast<uint32_t>(i)));
+  }
+  auto sorted_monsters = fbb.CreateVectorOfSortedTables(&monsters);
+  auto sorted_stats = fbb.CreateVectorOfSortedTables(&stats);
+  auto sorted_abilities = fbb.CreateVectorOfSortedStructs(&abilities);
+  auto name = fbb.CreateString("root");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_testarrayoftables(sorted_monsters);
+  mb.add_scalar_key_sorted_tables(sorted_stats);
+  mb.add_testarrayofsortedstruct(sorted_abilities);
+  FinishMonsterBuffer(fbb, mb.Finish());
+
+  auto monster = GetMonster(fbb.GetBufferPointer());
+  auto tables = monster->testarrayoftables();
+  auto stat_tables = monster->scalar_key_sorted_tables();
+  auto structs = monster->testarrayofsortedstruct();
+  for (flatbuffers::uoffset_t i = 1; i < 1000; i++) {
+    TEST_EQ(tables->Get(i)->KeyCompareLessThan(tables->Get(i - 1)), false);
+    TEST_EQ(stat_tables->Get(i)->KeyCompareLessThan(stat_tables->Get(i - 1)),
+            false);
+    TEST_EQ(structs->Get(i)->KeyCompareLessThan(structs->Get(i - 1)), false);
+  }
+  TEST_NOTNULL(tables->LookupByKey(tables->Get(123)->name()->c_str()));
+  TEST_EQ(structs->LookupByKey(structs->Get(456)->id()), structs->Get(456));
+
+  // Signed and floating point keys sort like operator<.
+  std::vector<int32_t> ints;
+  std::vector<double> doubles;
+  for (int i = 0; i < 300; i++) {
+    ints.push_back(static_cast<int32_t>(lcg_rand()));
+    doubles.push_back((static_cast<double>(lcg_rand()) - 1e9) / 3);
+  }
+  doubles.push_back(-0.0);
+  doubles.push_back(0.0);
+  auto sorted_ints = ints;
+  auto sorted_doubles = doubles;
+  std::sort(sorted_ints.begin(), sorted_ints.end());
+  std::sort(sorted_doubles.begin(), sorted_doubles.end());
+  TEST_EQ(flatbuffers::SortByKey(flatbuffers::data(ints), ints.size(),
+                                 [](int32_t k) { return k; }),
+          false);
+  TEST_EQ(flatbuffers::SortByKey(flatbuffers::data(doubles), doubles.size(),
+                                 [](double k) { return k; }),
+          false);
+  TEST_EQ(ints == sorted_ints, true);
+  TEST_EQ(doubles == sorted_doubles, true);
+
+  // Flexbuffer maps, which also report duplicate keys.
+  flexbuffers::Builder slb;
+  slb.Map([&]() {
+    for (int i = 0; i < 100; i++) {
+      slb.Int(("key" + flatbuffers::NumToString((i * 37) % 100)).c_str(), i);
+    }
+  });
+  slb.Finish();
+  TEST_EQ(slb.HasDuplicateKeys(), false);
+  auto map = flexbuffers::GetRoot(slb.GetBuffer()).AsMap();
+  TEST_EQ(map.size(), 100U);
+  for (int i = 0; i < 100; i++) {
+    auto key = "key" + flatbuffers::NumToString((i * 37) % 100);
+    TEST_EQ(map[key].AsInt32(), i);
+  }
+  flexbuffers::Builder dup;
+  dup.Map([&]() {
+    dup.Int("a_long_key_1", 1);
+    dup.Int("a_long_key_2", 2);
+    dup.Int("a_long_key_1", 3);
+  });
+  dup.Finish();
+  TEST_EQ(dup.HasDuplicateKeys(), true);
+}
+
+void LookupByKeyTest() {
+  // Every vector size up to a few levels of search, looking up each present
+  // key and the missing ones between and around them.
+  for (int len = 0; len < 40; len++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<Monster>> monsters;
+    std::vector<flatbuffers::Offset<Stat>> stats;
+    std::vector<Ability> abilities;
+    for (int i = 0; i < len; i++) {
+      // Names of different lengths, that share prefixes.
+      auto name = fbb.CreateString(std::string(static_cast<size_t>(i), 'b'));
+      monsters.push_back(CreateMonster(fbb, nullptr, 0, 0, name));
+      stats.push_back(CreateStat(fbb, 0, i, static_cast<uint16_t>(2 * i + 1)));
+      abilities.push_back(Ability(static_cast<uint32_t>(2 * i + 1), 0));
+    }
+    auto tables = fbb.CreateVectorOfSortedTables(&monsters);
+    auto stat_tables = fbb.CreateVectorOfSortedTables(&stats);
+    auto structs = fbb.CreateVectorOfSortedStructs(&abilities);
+    auto name = fbb.CreateString("root");
+    MonsterBuilder mb(fbb);
+    mb.add_name(name);
+    mb.add_testarrayoftables(tables);
+    mb.add_scalar_key_sorted_tables(stat_tables);
+    mb.add_testarrayofsortedstruct(structs);
+    FinishMonsterBuffer(fbb, mb.Finish());
+    auto monster = GetMonster(fbb.GetBufferPointer());
+    for (int i = 0; i < len; i++) {
+      auto key = std::string(static_cast<size_t>(i), 'b');
+      auto found = monster->testarrayoftables()->LookupByKey(key.c_str());
+      TEST_NOTNULL(found);
+      TEST_EQ(found->name()->str(), key);
+      TEST_EQ(monster->testarrayoftables()->LookupByKey((key + "a").c_str()),
+              static_cast<const Monster *>(nullptr));
+      TEST_EQ(monster->testarrayoftables()->LookupByKey((key + "c").c_str()),
+              static_cast<const Monster *>(nullptr));
+    }
+    TEST_EQ(monster->testarrayoftables()->LookupByKey("a"),
+            static_cast<const Monster *>(nullptr));
+    for (int k = 0; k <= 2 * len; k++) {
+      auto stat = monster->scalar_key_sorted_tables()->LookupByKey(
+          static_cast<uint16_t>(k));
+      auto ability = monster->testarrayofsortedstruct()->LookupByKey(
+          static_cast<uint32_t>(k));
+      if (k % 2) {
+        TEST_NOTNULL(stat);
+        TEST_EQ(stat->count(), k);
+        TEST_EQ(stat->val(), k / 2);
+        TEST_NOTNULL(ability);
+        TEST_EQ(ability->id(), static_cast<uint32_t>(k));
+      } else {
+        TEST_EQ(stat, static_cast<const Stat *>(nullptr));
+        TEST_EQ(ability, static_cast<const Ability *>(nullptr));
+      }
+    }
+  }
+}
+
+// A table and a struct with a key, as generated by older versions of flatc:
+// they can be compared, but don't have GetKey().
+struct LegacyKeyTable : private flatbuffers::Table {
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(Monster::VT_NAME);
+  }
+  bool KeyCompareLessThan(const LegacyKeyTable *o) const {
+    return *name() < *o->name();
+  }
+  int KeyCompareWithValue(const char *val) const {
+    return strcmp(name()->c_str(), val);
+  }
+};
+
+struct LegacyKeyStruct {
+  uint32_t id;
+  bool KeyCompareLessThan(const LegacyKeyStruct *o) const {
+    return id < o->id;
+  }
+  int KeyCompareWithValue(uint32_t val) const {
+    return static_cast<int>(id > val) - static_cast<int>(id < val);
+  }
+};
+
+void LegacyKeyTest() {
+  for (int len = 0; len < 20; len++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<LegacyKeyTable>> tables;
+    std::vector<LegacyKeyStruct> structs;
+    for (int i = 0; i < len; i++) {
+      auto k = 2 * ((i * 23) % len) + 1;
+      auto name = fbb.CreateString(std::string(static_cast<size_t>(k), 'b'));
+      tables.push_back(CreateMonster(fbb, nullptr, 0, 0, name).o);
+      LegacyKeyStruct s = { static_cast<uint32_t>(k) };
+      structs.push_back(s);
+    }
+    auto eytzinger_offset = fbb.CreateVectorOfEytzingerTables(tables);
+    auto tables_offset = fbb.CreateVectorOfSortedTables(&tables);
+    auto structs_offset = fbb.CreateVectorOfSortedStructs(&structs);
+    auto sorted_tables = flatbuffers::GetTemporaryPointer(fbb, tables_offset);
+    auto sorted_structs = flatbuffers::GetTemporaryPointer(fbb, structs_offset);
+    flatbuffers::EytzingerVector<flatbuffers::Offset<LegacyKeyTable>>
+        eytzinger_tables(flatbuffers::GetTemporaryPointer(fbb, eytzinger_offset));
+    for (int k = 0; k <= 2 * len; k++) {
+      auto key = std::string(static_cast<size_t>(k), 'b');
+      auto table = sorted_tables->LookupByKey(key.c_str());
+      auto eytzinger_table = eytzinger_tables.LookupByKey(key.c_str());
+      auto s = sorted_structs->LookupByKey(static_cast<uint32_t>(k));
+      if (k % 2) {
+        TEST_EQ(table->name()->str(), key);
+        TEST_EQ(table, sorted_tables->Get(static_cast<uint32_t>(k / 2)));
+        TEST_EQ(eytzinger_table->name()->str(), key);
+        TEST_EQ(s->id, static_cast<uint32_t>(k));
+      } else {
+        TEST_EQ(table, static_cast<const LegacyKeyTable *>(nullptr));
+        TEST_EQ(eytzinger_table, static_cast<const LegacyKeyTable *>(nullptr));
+        TEST_EQ(s, static_cast<const LegacyKeyStruct *>(nullptr));
+      }
+    }
+  }
+}
+
+void EytzingerTest() {
+  using namespace eytzinger_test;
+  for (int len = 0; len < 40; len++) {
+    // Keys 1, 3, 5, ... given in a scrambled order.
+    std::vector<int> keys;
+    for (int i = 0; i < len; i++) keys.push_back(2 * ((i * 43) % len) + 1);
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<Entry>> entries;
+    std::vector<Point> points;
+    for (auto it = keys.begin(); it != keys.end(); ++it) {
+      // Names of different lengths, that share prefixes.
+      auto name = std::string(static_cast<size_t>(*it), 'b');
+      entries.push_back(CreateEntryDirect(fbb, name.c_str(), *it));
+      points.push_back(Point(static_cast<uint32_t>(*it), 0, 0));
+    }
+    fbb.Finish(CreateIndexDirect(fbb, &entries, &points));
+    auto index = GetIndex(fbb.GetBufferPointer());
+
+    // Each element is larger than its left child and smaller than its right.
+    auto stored = index->points();
+    for (flatbuffers::uoffset_t k = 1; k <= stored->size(); k++) {
+      if (2 * k <= stored->size())
+        TEST_ASSERT(stored->Get(2 * k - 1)->id() < stored->Get(k - 1)->id());
+      if (2 * k + 1 <= stored->size())
+        TEST_ASSERT(stored->Get(2 * k)->id() > stored->Get(k - 1)->id());
+    }
+
+    // Iteration is in key order.
+    TEST_EQ(index->entries_by_key().size(), static_cast<size_t>(len));
+    int expected = 1;
+    for (auto it = index->points_by_key().begin();
+         it != index->points_by_key().end(); ++it) {
+      TEST_EQ((*it)->id(), static_cast<uint32_t>(expected));
+      expected += 2;
+    }
+    TEST_EQ(expected, 2 * len + 1);
+    expected = 1;
+    for (auto it = index->entries_by_key().begin();
+         it != index->entries_by_key().end(); ++it) {
+      TEST_EQ(it->value(), expected);
+      expected += 2;
+    }
+    TEST_EQ(expected, 2 * len + 1);
+
+    for (int k = 0; k <= 2 * len + 1; k++) {
+      auto name = std::string(static_cast<size_t>(k), 'b');
+      auto entry = index->entries_by_key().LookupByKey(name.c_str());
+      auto point =
+          index->points_by_key().LookupByKey(static_cast<uint32_t>(k));
+      if (k % 2 && k < 2 * len) {
+        TEST_NOTNULL(entry);
+        TEST_EQ(entry->value(), k);
+        TEST_NOTNULL(point);
+        TEST_EQ(point->id(), static_cast<uint32_t>(k));
+      } else {
+        TEST_EQ(entry, static_cast<const Entry *>(nullptr));
+        TEST_EQ(point, static_cast<const Point *>(nullptr));
+      }
+    }
+
+    // Packing the object API keeps the layout, even if the objects are
+    // reordered.
+    std::unique_ptr<IndexT> object(index->UnPack());
+    std::reverse(object->entries.begin(), object->entries.end());
+    std::reverse(object->points.begin(), object->points.end());
+    flatbuffers::FlatBufferBuilder fbb2;
+    fbb2.Finish(Index::Pack(fbb2, object.get()));
+    auto packed = GetIndex(fbb2.GetBufferPointer());
+    TEST_EQ(flatbuffers::VectorLength(packed->entries()),
+            flatbuffers::VectorLength(index->entries()));
+    for (flatbuffers::uoffset_t i = 0; i < stored->size(); i++) {
+      TEST_EQ(packed->entries()->Get(i)->value(),
+              index->entries()->Get(i)->value());
+      TEST_EQ(packed->points()->Get(i)->id(), stored->Get(i)->id());
+    }
+  }
+
+  // An absent vector has no elements.
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.Finish(CreateIndex(fbb));
+  auto empty = GetIndex(fbb.GetBufferPointer());
+  TEST_EQ(empty->entries_by_key().size(), 0U);
+  TEST_ASSERT(empty->points_by_key().begin() == empty->points_by_key().end());
+  TEST_EQ(empty->entries_by_key().LookupByKey("b"),
+          static_cast<const Entry *>(nullptr));
+
+  // JSON is stored in the same order.
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("struct P { id:uint (key); }"
+                       "table E { name:string (key); }"
+                       "table I { e:[E] (eytzinger); p:[P] (eytzinger); }"
+                       "root_type I;"
+                       "{ e: [{ name: \"d\" }, { name: \"a\" },"
+                       "      { name: \"c\" }, { name: \"b\" }],"
+                       "  p: [{ id: 4 }, { id: 1 }, { id: 3 }, { id: 2 }] }"),
+          true);
+  std::string json;
+  TEST_ASSERT(GenerateText(parser, parser.builder_.GetBufferPointer(), &json));
+  TEST_EQ_STR(json.c_str(),
+              "{\n"
+              "  e: [\n"
+              "    {\n      name: \"c\"\n    },\n"
+              "    {\n      name: \"b\"\n    },\n"
+              "    {\n      name: \"d\"\n    },\n"
+              "    {\n      name: \"a\"\n    }\n"
+              "  ],\n"
+              "  p: [\n"
+              "    {\n      id: 3\n    },\n"
+              "    {\n      id: 2\n    },\n"
+              "    {\n      id: 4\n    },\n"
+              "    {\n      id: 1\n    }\n"
+              "  ]\n"
+              "}\n");
+
+  TestError("table T { e:[int] (eytzinger); }", "may only apply to a vector");
+  TestError("table E { a:int; } table T { e:[E] (eytzinger); }",
+            "may only hold tables or structs with a key");
+  TestError("struct S { a:int; } struct T { s:S (eytzinger); }",
+            "can't be used in structs");
+}
+
+void HashIndexTest() {
+  using namespace hash_index_test;
+  for (int len = 0; len < 40; len++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<Entry>> entries;
+    std::vector<flatbuffers::Offset<Entry>> unindexed;
+    for (int i = 0; i < len; i++) {
+      auto name = "key" + flatbuffers::NumToString(i);
+      entries.push_back(CreateEntryDirect(fbb, name.c_str(), i));
+      unindexed.push_back(CreateEntryDirect(fbb, name.c_str(), i));
+    }
+    fbb.Finish(CreateDictionaryDirect(fbb, &entries, &unindexed));
+    auto dict = GetDictionary(fbb.GetBufferPointer());
+    auto index = dict->entries_hash_index();
+    TEST_NOTNULL(index);
+    TEST_ASSERT(index->size() > 2 * static_cast<flatbuffers::uoffset_t>(len));
+    TEST_EQ(index->size() & (index->size() - 1), 0U);
+
+    for (int i = 0; i < len; i++) {
+      auto name = "key" + flatbuffers::NumToString(i);
+      auto entry = dict->entries_by_key_hashed(name.c_str());
+      TEST_NOTNULL(entry);
+      TEST_EQ(entry->value(), i);
+      // Without an index, this is a binary search.
+      entry = flatbuffers::LookupByKeyHashed(dict->unindexed(), nullptr,
+                                             name.c_str());
+      TEST_NOTNULL(entry);
+      TEST_EQ(entry->value(), i);
+    }
+    TEST_EQ(dict->entries_by_key_hashed("key"),
+            static_cast<const Entry *>(nullptr));
+    TEST_EQ(dict->entries_by_key_hashed("key00"),
+            static_cast<const Entry *>(nullptr));
+    TEST_EQ(flatbuffers::LookupByKeyHashed(dict->unindexed(), nullptr, "a"),
+            static_cast<const Entry *>(nullptr));
+
+    // The object API recomputes the index.
+    std::unique_ptr<DictionaryT> object(dict->UnPack());
+    object->entries_hash_index.clear();
+    flatbuffers::FlatBufferBuilder fbb2;
+    fbb2.Finish(Dictionary::Pack(fbb2, object.get()));
+    auto packed = GetDictionary(fbb2.GetBufferPointer());
+    TEST_EQ(flatbuffers::VectorLength(packed->entries_hash_index()),
+            len ? index->size() : 0);
+    if (len) {
+      TEST_EQ(packed->entries_by_key_hashed("key0")->value(), 0);
+    }
+  }
+
+  // A missing or unusable index falls back to a binary search.
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Entry>> entries;
+  entries.push_back(CreateEntryDirect(fbb, "b", 2));
+  entries.push_back(CreateEntryDirect(fbb, "a", 1));
+  auto sorted = fbb.CreateVectorOfSortedTables(&entries);
+  std::vector<uint32_t> bad_index(3, 7);
+  fbb.Finish(CreateDictionary(fbb, sorted, fbb.CreateVector(bad_index)));
+  auto dict = GetDictionary(fbb.GetBufferPointer());
+  TEST_EQ(dict->entries_by_key_hashed("a")->value(), 1);
+  TEST_EQ(flatbuffers::LookupByKeyHashed(dict->entries(), nullptr, "b")
+              ->value(),
+          2);
+  bad_index.push_back(7);  // Right size, but positions out of range.
+  fbb.Clear();
+  entries.clear();
+  entries.push_back(CreateEntryDirect(fbb, "b", 2));
+  entries.push_back(CreateEntryDirect(fbb, "a", 1));
+  sorted = fbb.CreateVectorOfSortedTables(&entries);
+  fbb.Finish(CreateDictionary(fbb, sorted, fbb.CreateVector(bad_index)));
+  dict = GetDictionary(fbb.GetBufferPointer());
+  TEST_EQ(dict->entries_by_key_hashed("b")->value(), 2);
+
+  TestError("table E { k:int (key); } table T { e:[E] (hash_index); }",
+            "may only hold tables with a string key");
+  TestError("table T { e:[string] (hash_index); }",
+            "may only apply to a vector of tables");
+  TestError(
+      "table E { k:string (key); }"
+      "table T { e:[E] (hash_index); e_hash_index:[uint]; }",
+      "field already exists");
+}
+
+void PrefetchedTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  std::vector<std::string> names;
+  for (int i = 0; i < 100; i++) {
+    names.push_back("monster" + flatbuffers::NumToString(i));
+    monsters.push_back(CreateMonster(fbb, nullptr, 0, static_cast<int16_t>(i),
+                                     fbb.CreateString(names.back())));
+  }
+  auto tables = fbb.CreateVector(monsters);
+  auto strings = fbb.CreateVectorOfStrings(names);
+  auto name = fbb.CreateString("root");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_testarrayoftables(tables);
+  mb.add_testarrayofstring(strings);
+  FinishMonsterBuffer(fbb, mb.Finish());
+  auto monster = GetMonster(fbb.GetBufferPointer());
+
+  // The same elements in the same order, whatever the distance.
+  for (flatbuffers::uoffset_t distance = 0; distance < 200; distance += 7) {
+    int i = 0;
+    for (auto m : flatbuffers::Prefetched(monster->testarrayoftables(),
+                                          distance)) {
+      TEST_EQ(m->hp(), i);
+      TEST_EQ_STR(m->name()->c_str(), names[static_cast<size_t>(i)].c_str());
+      i++;
+    }
+    TEST_EQ(i, 100);
+    i = 0;
+    for (auto s :
+         flatbuffers::Prefetched(monster->testarrayofstring(), distance)) {
+      TEST_EQ(s->str(), names[static_cast<size_t>(i++)]);
+    }
+    TEST_EQ(i, 100);
+  }
+  monster->testarrayoftables()->prefetch_range(0, 100);
+  monster->testarrayofstring()->prefetch_range(50, 50);
+
+  // Absent vectors are empty.
+  auto empty = flatbuffers::Prefetched(monster->testarrayofsortedstruct());
+  TEST_EQ(empty.size(), 0U);
+  TEST_ASSERT(empty.begin() == empty.end());
+}
+
+template<typename T>
+void CheckColumn(const flatbuffers::Column<T> &col, const std::vector<T> &v) {
+  decltype(flatbuffers::ColumnSum(col)) sum = 0;
+  auto min = std::numeric_limits<T>::has_infinity
+                 ? std::numeric_limits<T>::infinity()
+                 : (std::numeric_limits<T>::max)();
+  auto max = std::numeric_limits<T>::has_infinity
+                 ? -std::numeric_limits<T>::infinity()
+                 : std::numeric_limits<T>::lowest();
+  size_t less = 0;
+  std::vector<flatbuffers::uoffset_t> equal;
+  const T pivot = v.empty() ? T() : v[v.size() / 2];
+  for (size_t i = 0; i < v.size(); i++) {
+    sum += v[i];
+    min = (std::min)(min, v[i]);
+    max = (std::max)(max, v[i]);
+    less += v[i] < pivot;
+    if (v[i] == pivot) equal.push_back(static_cast<flatbuffers::uoffset_t>(i));
+  }
+  TEST_EQ(col.size(), v.size());
+  TEST_EQ(flatbuffers::ColumnSum(col), sum);
+  TEST_EQ(flatbuffers::ColumnMin(col), min);
+  TEST_EQ(flatbuffers::ColumnMax(col), max);
+  TEST_EQ(flatbuffers::ColumnCountIf(col, flatbuffers::kColumnLess, pivot),
+          less);
+  TEST_EQ(flatbuffers::ColumnCountIf(col, flatbuffers::kColumnGreaterEqual,
+                                     pivot),
+          v.size() - less);
+  TEST_EQ(flatbuffers::ColumnCountIf(col, flatbuffers::kColumnNotEqual, pivot),
+          v.size() - equal.size());
+  std::vector<flatbuffers::uoffset_t> indices;
+  flatbuffers::ColumnFilter(col, flatbuffers::kColumnEqual, pivot, &indices);
+  TEST_ASSERT(indices == equal);
+  indices.clear();
+  flatbuffers::ColumnFilter(col, flatbuffers::kColumnLessEqual, pivot,
+                            &indices);
+  TEST_EQ(indices.size(), less + equal.size());
+  for (auto it = indices.begin(); it != indices.end(); ++it) {
+    TEST_ASSERT(v[*it] <= pivot);
+  }
+}
+
+void ColumnKernelsTest() {
+  const flatbuffers::ColumnIsa isas[] = { flatbuffers::kColumnScalar,
+                                          flatbuffers::kColumnSSE2,
+                                          flatbuffers::kColumnAVX2 };
+  const size_t sizes[] = { 0, 3, 8, 13, 100, 1001 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    std::vector<float> floats;
+    std::vector<int32_t> ints;
+    std::vector<Vec3> vecs;
+    std::vector<Ability> abilities;
+    for (size_t i = 0; i < sizes[s]; i++) {
+      const auto k = static_cast<int>(i * 37 % 101) - 50;
+      floats.push_back(static_cast<float>(k) * 0.5f);
+      // Large enough for the sum to overflow 32 bits.
+      ints.push_back(k * 40000000);
+      vecs.push_back(Vec3(0, static_cast<float>(k), 0, 0, Color_Red, Test()));
+      abilities.push_back(Ability(0, static_cast<uint32_t>(k + 50)));
+    }
+    flatbuffers::FlatBufferBuilder fbb;
+    auto float_vec = fbb.CreateVector(floats);
+    auto int_vec = fbb.CreateVector(ints);
+    auto vec3_vec = fbb.CreateVectorOfStructs(vecs);
+    auto ability_vec = fbb.CreateVectorOfStructs(abilities);
+    for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); i++) {
+      // All instruction sets give the same results, where supported.
+      flatbuffers::SetMaxColumnIsa(isas[i]);
+      CheckColumn(flatbuffers::Column<float>(
+                      flatbuffers::GetTemporaryPointer(fbb, float_vec)),
+                  floats);
+      CheckColumn(flatbuffers::Column<int32_t>(
+                      flatbuffers::GetTemporaryPointer(fbb, int_vec)),
+                  ints);
+      std::vector<float> ys;
+      for (auto it = vecs.begin(); it != vecs.end(); ++it) {
+        ys.push_back(it->y());
+      }
+      CheckColumn(flatbuffers::StructColumn<float>(
+                      flatbuffers::GetTemporaryPointer(fbb, vec3_vec),
+                      Vec3::OFFSET_Y),
+                  ys);
+      std::vector<uint32_t> distances;
+      for (auto it = abilities.begin(); it != abilities.end(); ++it) {
+        distances.push_back(it->distance());
+      }
+      CheckColumn(flatbuffers::StructColumn<uint32_t>(
+                      flatbuffers::GetTemporaryPointer(fbb, ability_vec),
+                      Ability::OFFSET_DISTANCE),
+                  distances);
+    }
+  }
+  flatbuffers::SetMaxColumnIsa(flatbuffers::kColumnAVX2);
+
+  // Absent vectors are empty columns.
+  const flatbuffers::Vector<float> *none = nullptr;
+  flatbuffers::Column<float> empty(none);
+  TEST_EQ(empty.size(), 0U);
+  TEST_EQ(flatbuffers::ColumnSum(empty), 0.0);
+  TEST_EQ(flatbuffers::ColumnMin(empty),
+          std::numeric_limits<float>::infinity());
 }
 
 #if !defined(FLATBUFFERS_SPAN_MINIMAL)
@@ -3854,6 +5396,30 @@ int FlatBufferTests() {
   TypeAliasesTest();
   EndianSwapTest();
   CreateSharedStringTest();
+  VtableDedupHashedTest();
+  SegmentedBufferTest();
+  RewindToTest();
+  SharedObjectsTest();
+  VerifySharedTest();
+  VerifierVTableCacheTest();
+  ParallelVerifyTest();
+  VerifierStatsTest();
+  ArenaAllocatorTest();
+  BufferSizeHintTest();
+  BuilderStatsTest();
+  PackedSizeUpperBoundTest();
+  SpliceTest();
+  Offset64Test();
+  PrecomputedVTableTest();
+  BulkVectorOfStringsTest();
+  KeySortTest();
+  LookupByKeyTest();
+  LegacyKeyTest();
+  EytzingerTest();
+  HashIndexTest();
+  PrefetchedTest();
+  ColumnKernelsTest();
+  MmapFileBuilderTest();
   JsonDefaultTest();
   JsonEnumsTest();
   FlexBuffersTest();
@@ -99,6 +99,7 @@ struct CharacterUnion {
 
   static void *UnPack(const void *obj, Character type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
 
   AttackerT *AsMuLan() {
     return type == Character_MuLan ?
@@ -202,6 +203,9 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Rapunzel FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return RapunzelTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_HAIR_LENGTH = 0
+  };
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
     return "Rapunzel";
   }
@@ -238,6 +242,9 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) BookReader FLATBUFFERS_FINAL_CLASS {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return BookReaderTypeTable();
   }
+  enum FlatBuffersStructOffset {
+    OFFSET_BOOKS_READ = 0
+  };
   static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
     return "BookReader";
   }
@@ -339,6 +346,7 @@ inline flatbuffers::Offset<Attacker> CreateAttacker(
 }
 
 flatbuffers::Offset<Attacker> CreateAttacker(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const AttackerT &_o);
 
 struct MovieT : public flatbuffers::NativeTable {
   typedef Movie TableType;
@@ -489,6 +497,7 @@ inline flatbuffers::Offset<Movie> CreateMovieDirect(
 }
 
 flatbuffers::Offset<Movie> CreateMovie(flatbuffers::FlatBufferBuilder &_fbb, const MovieT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MovieT &_o);
 
 inline AttackerT *Attacker::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<AttackerT>(new AttackerT());
@@ -502,7 +511,14 @@ inline void Attacker::UnPackTo(AttackerT *_o, const flatbuffers::resolver_functi
   { auto _e = sword_attack_damage(); _o->sword_attack_damage = _e; }
 }
 
+inline size_t GetPackedSizeUpperBound(const AttackerT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(1, 7);
+  return _size;
+}
+
 inline flatbuffers::Offset<Attacker> Attacker::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateAttacker(_fbb, _o, _rehasher);
 }
 
@@ -531,7 +547,18 @@ inline void Movie::UnPackTo(MovieT *_o, const flatbuffers::resolver_function_t *
   { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].value = CharacterUnion::UnPack(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } }
 }
 
+inline size_t GetPackedSizeUpperBound(const MovieT &_o) {
+  (void)_o;
+  size_t _size = flatbuffers::FlatBufferBuilder::TableSizeUpperBound(4, 22);
+  _size += _o.main_character.GetPackedSizeUpperBound();
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.characters.size(), 1, 1);
+  _size += flatbuffers::FlatBufferBuilder::VectorSizeUpperBound(_o.characters.size(), 4, 4);
+  for (const auto &_e : _o.characters) _size += _e.GetPackedSizeUpperBound();
+  return _size;
+}
+
 inline flatbuffers::Offset<Movie> Movie::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(*_o));
   return CreateMovie(_fbb, _o, _rehasher);
 }
 
@@ -653,6 +680,33 @@ inline flatbuffers::Offset<void> CharacterUnion::Pack(flatbuffers::FlatBufferBui
   }
 }
 
+inline size_t CharacterUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case Character_MuLan: {
+      auto ptr = reinterpret_cast<const AttackerT *>(value);
+      return ::GetPackedSizeUpperBound(*ptr);
+    }
+    case Character_Rapunzel: {
+      return 7;
+    }
+    case Character_Belle: {
+      return 7;
+    }
+    case Character_BookFan: {
+      return 7;
+    }
+    case Character_Other: {
+      auto ptr = reinterpret_cast<const std::string *>(value);
+      return flatbuffers::FlatBufferBuilder::StringSizeUpperBound(ptr->length());
+    }
+    case Character_Unused: {
+      auto ptr = reinterpret_cast<const std::string *>(value);
+      return flatbuffers::FlatBufferBuilder::StringSizeUpperBound(ptr->length());
+    }
+    default: return 0;
+  }
+}
+
 inline CharacterUnion::CharacterUnion(const CharacterUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Character_MuLan: {
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Tests of the Verifier rejecting buffers. These can't be in flattests, which
+// asserts on any verification failure (FLATBUFFERS_DEBUG_VERIFICATION_FAILURE).
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/parallel_verifier.h"
+#include "monster_test_generated.h"
+#include "test_assert.h"
+
+using namespace MyGame::Example;
+
+// A root monster with 1000 named monsters in a vector.
+static void BuildMonsters(flatbuffers::FlatBufferBuilder &fbb) {
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 1000; i++) {
+    auto name = fbb.CreateString("monster" + flatbuffers::NumToString(i));
+    monsters.push_back(CreateMonster(fbb, nullptr, 0, 0, name));
+  }
+  auto tables = fbb.CreateVector(monsters);
+  auto name = fbb.CreateString("root");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_testarrayoftables(tables);
+  FinishMonsterBuffer(fbb, mb.Finish());
+}
+
+void FailurePathTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  BuildMonsters(fbb);
+  std::vector<uint8_t> buf(fbb.GetBufferPointer(),
+                           fbb.GetBufferPointer() + fbb.GetSize());
+  // The name of monster 700 claims to be longer than the buffer.
+  auto name = GetMonster(buf.data())->testarrayoftables()->Get(700)->name();
+  auto name_offset =
+      static_cast<size_t>(reinterpret_cast<const uint8_t *>(name) - buf.data());
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(&buf[name_offset],
+                                                    0x10000000);
+
+  // Sequentially, on threads, and on an executor running the parts in
+  // reverse, which finds the failure in the last part it runs.
+  flatbuffers::ParallelVerification threads(4, 100);
+  flatbuffers::ParallelVerification serial(
+      [](size_t count, const std::function<void(size_t)> &task) {
+        for (size_t i = count; i-- > 0;) task(i);
+      },
+      3, 100);
+  flatbuffers::ParallelVerification *parallelisms[] = { nullptr, &threads,
+                                                        &serial };
+  for (size_t i = 0; i < 3; i++) {
+    flatbuffers::Verifier verifier(buf.data(), buf.size());
+    verifier.SetParallelism(parallelisms[i]);
+    TEST_EQ(VerifyMonsterBuffer(verifier), false);
+    const auto &stats = verifier.GetStats();
+    TEST_EQ(stats.failed, true);
+    TEST_EQ(stats.failure_offset, name_offset);
+    TEST_EQ(stats.failure_path.size(), 2U);
+    TEST_EQ(stats.failure_path[0].field, Monster::VT_TESTARRAYOFTABLES);
+    TEST_EQ(stats.failure_path[0].index, 700U);
+    TEST_EQ(stats.failure_path[1].field, Monster::VT_NAME);
+    TEST_EQ(stats.failure_path[1].index, 0U);
+  }
+}
+
+void BudgetTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  BuildMonsters(fbb);
+
+  flatbuffers::Verifier unlimited(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(unlimited), true);
+  const auto bytes = unlimited.GetNumBytes();
+
+  // One byte too few, also when verified in parts.
+  flatbuffers::ParallelVerification threads(4, 100);
+  for (int parallel = 0; parallel < 2; parallel++) {
+    flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+    if (parallel) verifier.SetParallelism(&threads);
+    verifier.SetMaxBytes(bytes - 1);
+    TEST_EQ(VerifyMonsterBuffer(verifier), false);
+    TEST_EQ(verifier.GetStats().failed, true);
+  }
+
+  // The parts share the budget: after the vector, half of it is left for
+  // about a part and a half of the names. The second of 4 parts, run one
+  // after the other, stops where it runs out rather than checking all of its
+  // monsters.
+  flatbuffers::ParallelVerification serial(
+      [](size_t count, const std::function<void(size_t)> &task) {
+        for (size_t i = 0; i < count; i++) task(i);
+      },
+      4, 100);
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  verifier.SetParallelism(&serial);
+  verifier.SetMaxBytes(bytes / 2);
+  TEST_EQ(VerifyMonsterBuffer(verifier), false);
+  const auto &stats = verifier.GetStats();
+  TEST_EQ(stats.failed, true);
+  TEST_EQ(stats.vector_bytes + stats.string_bytes <= bytes / 2 + 16, true);
+
+  // A deadline that has passed by the time the clock is first looked at.
+  flatbuffers::Verifier late(fbb.GetBufferPointer(), fbb.GetSize());
+  late.SetDeadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+  TEST_EQ(VerifyMonsterBuffer(late), false);
+  TEST_EQ(late.GetStats().failed, true);
+  TEST_EQ(late.GetStats().failure_path.size(), 2U);
+  TEST_EQ(late.GetStats().failure_path[0].field,
+          Monster::VT_TESTARRAYOFTABLES);
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  InitTestEngine();
+
+  FailurePathTest();
+  BudgetTest();
+
+  if (!testing_fails) {
+    TEST_OUTPUT_LINE("Verifier: ALL TESTS PASSED");
+  } else {
+    TEST_OUTPUT_LINE("Verifier: %d FAILED TESTS", testing_fails);
+  }
+  return CloseTestEngine();
+}